@@ -59,7 +59,7 @@ class LidarDecision {
      * @return the most dangerous obstacle out of those given
      */
     static LidarObstacle
-    mostDangerousObstacle(const std::vector<LidarObstacle> obstacles);
+    mostDangerousObstacle(const std::vector<LidarObstacle>& obstacles);
 
     /**
      * Merges obstacles that are separated by less then max_angle_diff together
@@ -93,7 +93,7 @@ class LidarDecision {
      * @return a twist message
      */
     static geometry_msgs::Twist
-    twist_message_from_obstacle(LidarObstacle obstacle,
+    twist_message_from_obstacle(const LidarObstacle& obstacle,
                                 distance_t danger_distance,
                                 angle_t danger_angle,
                                 float linear_vel_multiplier,
@@ -12,6 +12,9 @@
 #include <algorithm>
 #include <vector>
 
+// Snowbots
+#include <ObstacleReadings.h>
+
 using distance_t = float;
 using angle_t    = float;
 
@@ -48,7 +51,7 @@ class LidarObstacle {
     *
     * @return the distance to the rightmost point of the Obstacle
     */
-    distance_t getFirstDistance();
+    distance_t getFirstDistance() const;
 
     /**
     * Gets the distance to the leftmost point of the Obstacle
@@ -56,7 +59,7 @@ class LidarObstacle {
     * @return the distance to the leftmost point of the obstacle
     */
 
-    distance_t getLastDistance();
+    distance_t getLastDistance() const;
     /**
      * Gets the average distance of the Obstacle from the robot
      *
@@ -64,7 +67,7 @@ class LidarObstacle {
      *
      * @return the distance of the Obstacle from the robot
      */
-    float getAvgDistance();
+    float getAvgDistance() const;
 
     /**
      * Gets the angle of the Obstacle from the robot
@@ -73,35 +76,35 @@ class LidarObstacle {
      *
      * @return the angle of the Obstacle from the robot
      */
-    float getAvgAngle();
+    float getAvgAngle() const;
 
     /**
      * Gets the minimum angle from of an object from the robot
      *
      * @return the minimum angle of the obstacle from the robot
      */
-    float getMinAngle();
+    float getMinAngle() const;
 
     /**
      * Gets the maximum angle from of an object from the robot
      *
      * @return the maximum angle of the obstacle from the robot
      */
-    float getMaxAngle();
+    float getMaxAngle() const;
 
     /**
      * Gets the minimum distance from of an object from the robot
      *
      * @return the minimum distance of the obstacle from the robot
      */
-    float getMinDistance();
+    float getMinDistance() const;
 
     /**
      * Gets the maximum distance from of an object from the robot
      *
      * @return the maximum distance of the obstacle from the robot
      */
-    float getMaxDistance();
+    float getMaxDistance() const;
 
     /**
      * Calculates a danger score for the obstacle
@@ -110,14 +113,17 @@ class LidarObstacle {
      *
      * @return danger_score how dangerous the obstacle is to the robot
      */
-    float dangerScore();
+    float dangerScore() const;
 
     /**
      * Gets all laser readings comprising the obstacle
      *
+     * The readings are stored as separate arrays of angles and ranges, so
+     * this builds a copy of them
+     *
      * @return readings A list of pairs of all laser readings
      */
-    const std::vector<Reading>& getAllLaserReadings();
+    std::vector<Reading> getAllLaserReadings() const;
 
     /**
      * Merges the given LidarObstacle in to this LidarObstacle
@@ -127,20 +133,23 @@ class LidarObstacle {
      *
      * @param obstacle The LidarObstacle to be merged in
      */
-    void mergeInLidarObstacle(LidarObstacle obstacle);
+    void mergeInLidarObstacle(const LidarObstacle& obstacle);
 
-  private:
     /**
-     * Merges a given set of readings into the obstacle
+     * Adds a single reading to this LidarObstacle
      *
-     * @param readings the readings to be merged in
+     * Readings added in order of angle are just appended
+     *
+     * @param angle the angle of the reading
+     * @param distance the distance of the reading
      */
-    void mergeInReadings(std::vector<Reading>& new_readings);
+    void addReading(angle_t angle, distance_t distance);
 
+  private:
     // The distances and angles of all the laser scan hits that comprise the
     // object.
     // pairs are stored in sorted order, from min to max angle.
-    std::vector<Reading> readings;
+    snowbots::ObstacleReadings<float> readings;
 };
 
 #endif // LIDAROBSTACLE_H
@@ -0,0 +1,115 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A binary mask stored as the runs of white pixels in each row,
+ *              along with the number of white pixels in each column, so that
+ *              an image only has to be read once to answer every question
+ *              VisionDecision asks of it
+ */
+
+#ifndef DECISION_RUN_LENGTH_MASK_H
+#define DECISION_RUN_LENGTH_MASK_H
+
+// STD
+#include <vector>
+
+// ROS
+#include <sensor_msgs/Image.h>
+
+// A run of white pixels in a row, from start up to (not including) end
+struct PixelRun {
+    int start;
+    int end;
+};
+
+class RunLengthMask {
+  public:
+    /**
+     * Creates an empty RunLengthMask
+     */
+    RunLengthMask();
+
+    /**
+     * Creates a RunLengthMask from a mono8 image
+     *
+     * @param image the image, in which every non-zero pixel is white
+     */
+    explicit RunLengthMask(const sensor_msgs::Image& image);
+
+    /**
+     * Replaces the contents of this mask with a mono8 image, in a single
+     * pass over its pixels
+     *
+     * @param image the image, in which every non-zero pixel is white
+     */
+    void build(const sensor_msgs::Image& image);
+
+    int getWidth() const { return width; }
+
+    int getHeight() const { return height; }
+
+    /**
+     * @return the first of the runs of white pixels in the given row, which
+     * are in order of increasing column
+     */
+    const PixelRun* rowBegin(int row) const {
+        return runs.data() + row_starts[row];
+    }
+
+    /**
+     * @return one past the last of the runs of white pixels in the given row
+     */
+    const PixelRun* rowEnd(int row) const {
+        return runs.data() + row_starts[row + 1];
+    }
+
+    /**
+     * Checks if a pixel is white
+     *
+     * @param row the row of the pixel
+     * @param column the column of the pixel
+     * @return true if the pixel is white, false otherwise
+     */
+    bool isWhite(int row, int column) const;
+
+    /**
+     * @return the number of white pixels in the mask
+     */
+    int getWhiteCount() const { return column_prefix_counts[width]; }
+
+    /**
+     * @return the number of white pixels in the given column
+     */
+    int getColumnWhiteCount(int column) const {
+        return getWhiteCountInColumns(column, column + 1);
+    }
+
+    /**
+     * Gets the number of white pixels in a range of columns
+     *
+     * @param first_column the first column to count
+     * @param end_column one past the last column to count
+     * @return the number of white pixels in columns [first_column, end_column)
+     */
+    int getWhiteCountInColumns(int first_column, int end_column) const {
+        return column_prefix_counts[end_column] -
+               column_prefix_counts[first_column];
+    }
+
+  private:
+    int width;
+    int height;
+
+    // The runs of every row, one row after another
+    std::vector<PixelRun> runs;
+
+    // Where the runs of each row start in runs, with one extra entry for
+    // the end of the last row
+    std::vector<size_t> row_starts;
+
+    // The number of white pixels in all columns before each column, with one
+    // extra entry for the whole mask
+    std::vector<int> column_prefix_counts;
+};
+
+#endif // DECISION_RUN_LENGTH_MASK_H
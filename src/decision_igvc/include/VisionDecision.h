@@ -12,6 +12,7 @@
 #include <iostream>
 
 // Snowbots
+#include <RunLengthMask.h>
 #include <sb_utils.h>
 
 // ROS
@@ -39,6 +40,15 @@ class VisionDecision {
   public:
     VisionDecision(int argc, char** argv, std::string node_name);
 
+    /**
+     * Constructor for when ROS has already been initialized, such as in a
+     * nodelet
+     *
+     * @param nh the handle to advertise with
+     * @param private_nh the handle to subscribe and get params with
+     */
+    VisionDecision(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
     /**
      * Determines the turning angle in relation to the orientation of
      * the white line in the image.
@@ -65,13 +75,13 @@ class VisionDecision {
      * @param rightSide determines whether to parse from the left or from the
      * right side.
      * @param numSamples how many slopes to sample the angle.
-     * @param image_scan the image to parse.
+     * @param mask the image to parse, as a RunLengthMask.
      *
      * @returns the angle of the line, or INVALID if line is invalid.
      */
     static int getAngleOfLine(bool rightSide,
                               double numSamples,
-                              const sensor_msgs::Image::ConstPtr& image,
+                              const RunLengthMask& mask,
                               double rolling_average_constant,
                               double percent_of_samples_needed,
                               double& validSamples);
@@ -103,12 +113,12 @@ class VisionDecision {
      * @param startingPos which column to start parsing in
      * @param row the row to parse
      * @param rightSide determines whether to parse from the right or the left
-     * @param image_scan the image to parse
+     * @param mask the image to parse
      */
     static int getMiddle(int startingPos,
                          int row,
                          bool rightSide,
-                         const sensor_msgs::Image::ConstPtr& image);
+                         const RunLengthMask& mask);
 
     /*
      * Returns the edge pixel of the line. Which side depends on parameter
@@ -119,7 +129,7 @@ class VisionDecision {
      * @param incrementer decides whether to parse from the left or from the
      * right
      * @param row determines the row to parse
-     * @param image_scan the image to parse
+     * @param mask the image to parse
      * @param isStartPixel determines which edge pixel of the white line to
      * return.
      *
@@ -128,9 +138,29 @@ class VisionDecision {
     static int getEdgePixel(int startingPos,
                             int incrementer,
                             int row,
-                            const sensor_msgs::Image::ConstPtr& image,
+                            const RunLengthMask& mask,
                             bool isStartPixel);
 
+    /**
+     * Feeds a stretch of same coloured pixels to the noise verification of
+     * getEdgePixel, as if they had been parsed one at a time.
+     *
+     * @param isTarget whether the pixels are the colour being searched for
+     * @param firstPos the position of the first pixel parsed
+     * @param length the number of pixels
+     * @param targetCount the verification count of the colour searched for
+     * @param otherCount the verification count of the other colour
+     * @param toBeChecked the pixel being verified, -1 if none
+     *
+     * @returns true if toBeChecked has been verified
+     */
+    static bool verifyEdgeStretch(bool isTarget,
+                                  int firstPos,
+                                  int length,
+                                  int& targetCount,
+                                  int& otherCount,
+                                  int& toBeChecked);
+
     /**
      * Re-maps a number from one range to another
      *
@@ -153,48 +183,53 @@ class VisionDecision {
     /**
      * Initializes the incrementer's starting position and how it will parse.
      *
-     * @param image_scan the image to parse.
+     * @param mask the image to parse.
      * @param rightSide determines whether to parse from the left or the right
      * side of the image.
      * @param startingPos where the parser will start parsing the image.
      */
-    static int initializeIncrementerPosition(
-    bool rightSide,
-    const sensor_msgs::Image::ConstPtr& image_scan,
-    int* startingPos);
+    static int initializeIncrementerPosition(bool rightSide,
+                                             const RunLengthMask& mask,
+                                             int* startingPos);
 
     /**
      * Checks whether the line is perpendicular to the robot's vision.
      *
-     * @param image_scan the image to parse.
+     * @param mask the image to parse.
      */
-    static bool isPerpendicular(const sensor_msgs::Image::ConstPtr& image_scan);
+    static bool isPerpendicular(const RunLengthMask& mask);
 
     /**
      * Gets the first valid white pixel bottom to top at the specified column.
      *
-     * @param image_scan the image to parse.
+     * @param mask the image to parse.
      * @param column the column to parse at.
      *
+     * @returns the white pixel's row position, -1 if none found
      */
-    static int
-    getVerticalEdgePixel(const sensor_msgs::Image::ConstPtr& image_scan,
-                         int column);
+    static int getVerticalEdgePixel(const RunLengthMask& mask, int column);
 
     /*
      * Returns an angle that moves away from the line
      *
-     * @param image_scan the image to parse
+     * @param mask the image to parse
      */
-    static int moveAwayFromLine(const sensor_msgs::Image::ConstPtr& image);
+    static int moveAwayFromLine(const RunLengthMask& mask);
 
     /*
      * Returns the difference of rightWhitePixels - leftWhitePixels
      *
-     * @param image_scan the image to parse
+     * @param mask the image to parse
+     */
+    static int getLeftToRightPixelRatio(const RunLengthMask& mask);
+
+    /**
+     * Sets up the subscriber, publisher and params of the node
+     *
+     * @param nh the handle to advertise with
+     * @param private_nh the handle to subscribe and get params with
      */
-    static int
-    getLeftToRightPixelRatio(const sensor_msgs::Image::ConstPtr& image);
+    void setUpNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
 
     void imageCallBack(const sensor_msgs::Image::ConstPtr& image);
 
@@ -0,0 +1,42 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which produces a recommended twist message from
+ *              a filtered image, see VisionDecision. Loaded into the same
+ *              manager as the sb_vision nodelets, it gets their images
+ *              without them being serialized.
+ */
+
+#ifndef DECISION_VISION_DECISION_NODELET_H
+#define DECISION_VISION_DECISION_NODELET_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+
+// STD
+#include <memory>
+
+#include <VisionDecision.h>
+
+namespace decision_igvc {
+
+class VisionDecisionNodelet : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    VisionDecisionNodelet();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    // The node doing the work, set up with the nodelet's handles
+    std::unique_ptr<VisionDecision> node;
+};
+}
+
+#endif // DECISION_VISION_DECISION_NODELET_H
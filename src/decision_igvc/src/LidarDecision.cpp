@@ -86,36 +86,46 @@ std::vector<LidarObstacle>
 LidarDecision::findObstacles(const sensor_msgs::LaserScan& scan,
                              float max_obstacle_angle_diff,
                              float max_obstacle_distance_diff) {
-    // Get the raw scan data
-    std::vector<float> scan_data = scan.ranges;
-
-    // Find all ranges (lidar hits) that could be obstacles (initially each
-    // laser hit is an obstacle)
-    std::vector<LidarObstacle> obstacles = {};
-    for (int i = 0; i < scan_data.size(); i++) {
+    const std::vector<float>& scan_data = scan.ranges;
+
+    // Sweep over the scan in order of ascending angle, growing the last
+    // obstacle while each lidar hit is close enough to it, and starting a new
+    // obstacle otherwise. Hits are compared to the last reading of the last
+    // obstacle, same as mergeSimilarObstacles would.
+    std::vector<LidarObstacle> obstacles;
+    obstacles.reserve(scan_data.size());
+    bool ascending = scan.angle_increment >= 0;
+    for (size_t n = 0; n < scan_data.size(); n++) {
+        size_t i = ascending ? n : scan_data.size() - 1 - n;
         // Check that obstacle is within valid range
-        if (scan_data[i] < scan.range_max && scan_data[i] > scan.range_min) {
-            // If so, add it to the obstacles
-            obstacles.emplace_back(LidarObstacle(
-            scan.angle_increment * i + scan.angle_min, scan_data[i]));
+        if (scan_data[i] >= scan.range_max || scan_data[i] <= scan.range_min) {
+            continue;
         }
-    }
 
-    // Merge together obstacles that could be the same obstacle
-    mergeSimilarObstacles(
-    obstacles, max_obstacle_angle_diff, max_obstacle_distance_diff);
+        float angle = scan.angle_increment * i + scan.angle_min;
+        if (!obstacles.empty() &&
+            fabs(angle - obstacles.back().getMaxAngle()) <
+            max_obstacle_angle_diff &&
+            fabs(scan_data[i] - obstacles.back().getLastDistance()) <
+            max_obstacle_distance_diff) {
+            obstacles.back().addReading(angle, scan_data[i]);
+        } else {
+            obstacles.emplace_back(angle, scan_data[i]);
+        }
+    }
 
     return obstacles;
 }
 
 LidarObstacle LidarDecision::mostDangerousObstacle(
-const std::vector<LidarObstacle> obstacles) {
+const std::vector<LidarObstacle>& obstacles) {
     // Return obstacle with the greatest danger score
-    return *std::max_element(obstacles.begin(),
-                             obstacles.end(),
-                             [&](LidarObstacle obs1, LidarObstacle obs2) {
-                                 return obs1.dangerScore() < obs2.dangerScore();
-                             });
+    return *std::max_element(
+    obstacles.begin(),
+    obstacles.end(),
+    [&](const LidarObstacle& obs1, const LidarObstacle& obs2) {
+        return obs1.dangerScore() < obs2.dangerScore();
+    });
 }
 
 void LidarDecision::mergeSimilarObstacles(std::vector<LidarObstacle>& obstacles,
@@ -124,30 +134,32 @@ void LidarDecision::mergeSimilarObstacles(std::vector<LidarObstacle>& obstacles,
     // Ensure the list of obstacles is sorted in order of ascending angle
     std::sort(obstacles.begin(),
               obstacles.end(),
-              [&](LidarObstacle l1, LidarObstacle l2) {
+              [&](const LidarObstacle& l1, const LidarObstacle& l2) {
                   return l1.getAvgAngle() < l2.getAvgAngle();
               });
 
-    // Merge similar obstacles
-    int i = 0;
-    while (i < (long) obstacles.size() - 1) {
+    // Merge similar obstacles in one pass, moving each obstacle that is not
+    // merged down to follow the last kept obstacle
+    if (obstacles.empty()) return;
+    size_t last_kept = 0;
+    for (size_t i = 1; i < obstacles.size(); i++) {
         // Check if angle difference between two consecutive scans is less than
         // max_angle_diff and max_distance_diff
-        if (fabs(obstacles[i + 1].getMinAngle() - obstacles[i].getMaxAngle()) <
-            max_angle_diff &&
-            fabs(obstacles[i + 1].getFirstDistance() -
-                 obstacles[i].getLastDistance()) < max_distance_diff) {
+        if (fabs(obstacles[i].getMinAngle() -
+                 obstacles[last_kept].getMaxAngle()) < max_angle_diff &&
+            fabs(obstacles[i].getFirstDistance() -
+                 obstacles[last_kept].getLastDistance()) < max_distance_diff) {
             // Merge next obstacle into current one
-            obstacles[i].mergeInLidarObstacle(obstacles[i + 1]);
-            obstacles.erase(obstacles.begin() + i + 1);
-        } else {
-            i++;
+            obstacles[last_kept].mergeInLidarObstacle(obstacles[i]);
+        } else if (++last_kept != i) {
+            obstacles[last_kept] = std::move(obstacles[i]);
         }
     }
+    obstacles.resize(last_kept + 1);
 }
 
 geometry_msgs::Twist
-LidarDecision::twist_message_from_obstacle(LidarObstacle obstacle,
+LidarDecision::twist_message_from_obstacle(const LidarObstacle& obstacle,
                                            distance_t danger_distance,
                                            angle_t danger_angle,
                                            float linear_vel_multiplier,
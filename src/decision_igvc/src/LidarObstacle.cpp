@@ -7,7 +7,6 @@
 
 // STD Includes
 #include <math.h>
-#include <numeric>
 
 // Snowbots Includes
 #include <LidarObstacle.h>
@@ -15,74 +14,60 @@
 LidarObstacle::LidarObstacle(){};
 
 LidarObstacle::LidarObstacle(angle_t angle, distance_t distance) {
-    readings.emplace_back(Reading{angle, distance});
+    readings.add(angle, distance);
 }
 
 LidarObstacle::LidarObstacle(std::vector<Reading> readings) {
-    this->mergeInReadings(readings);
+    for (const Reading& reading : readings) {
+        this->readings.add(reading.angle, reading.range);
+    }
 }
 
-distance_t LidarObstacle::getAvgDistance() {
-    float total_distance = std::accumulate(
-    readings.begin(), readings.end(), 0, [](int accumulator, auto reading) {
-        return accumulator + reading.range;
-    });
-    return total_distance / readings.size();
+distance_t LidarObstacle::getAvgDistance() const {
+    return readings.getAvgRange();
 }
 
-angle_t LidarObstacle::getAvgAngle() {
-    float total_angle = std::accumulate(
-    readings.begin(), readings.end(), 0.0, [](float accumulator, auto reading) {
-        return accumulator + reading.angle;
-    });
-    return total_angle / readings.size();
+angle_t LidarObstacle::getAvgAngle() const {
+    return readings.getAvgAngle();
 }
 
-angle_t LidarObstacle::getMinAngle() {
+angle_t LidarObstacle::getMinAngle() const {
     // Readings are sorted, so min angle is just the first Reading
-    return readings[0].angle;
+    return readings.getMinAngle();
 }
 
-angle_t LidarObstacle::getMaxAngle() {
+angle_t LidarObstacle::getMaxAngle() const {
     // Readings are sorted, so max angle is just the last Reading
-    return readings[readings.size() - 1].angle;
+    return readings.getMaxAngle();
 }
 
-distance_t LidarObstacle::getLastDistance() {
-    return readings[readings.size() - 1].range;
+distance_t LidarObstacle::getLastDistance() const {
+    return readings.getLastRange();
 }
 
-distance_t LidarObstacle::getFirstDistance() {
-    return readings[0].range;
+distance_t LidarObstacle::getFirstDistance() const {
+    return readings.getFirstRange();
 }
 
-const std::vector<Reading>& LidarObstacle::getAllLaserReadings() {
-    return readings;
-};
-
-distance_t LidarObstacle::getMinDistance() {
-    std::vector<Reading> readings = getAllLaserReadings();
-    Reading reading_with_min_distance =
-    *std::min_element(readings.begin(),
-                      readings.end(),
-                      [&](auto const& reading1, auto const& reading2) {
-                          return reading1.range < reading2.range;
-                      });
-    return reading_with_min_distance.range;
+std::vector<Reading> LidarObstacle::getAllLaserReadings() const {
+    std::vector<Reading> all_readings;
+    all_readings.reserve(readings.size());
+    for (size_t i = 0; i < readings.size(); i++) {
+        all_readings.emplace_back(
+        Reading{readings.getAngles()[i], readings.getRanges()[i]});
+    }
+    return all_readings;
 }
 
-distance_t LidarObstacle::getMaxDistance() {
-    std::vector<Reading> readings = getAllLaserReadings();
-    Reading reading_with_max_distance =
-    *std::max_element(readings.begin(),
-                      readings.end(),
-                      [&](auto const& reading1, auto const& reading2) {
-                          return reading1.range > reading2.range;
-                      });
-    return reading_with_max_distance.range;
+distance_t LidarObstacle::getMinDistance() const {
+    return readings.getMinRange();
 }
 
-float LidarObstacle::dangerScore() {
+distance_t LidarObstacle::getMaxDistance() const {
+    return readings.getMaxRange();
+}
+
+float LidarObstacle::dangerScore() const {
     // angle score increases as an obstacle's angle relative to the robot
     // increases
     float angle_score = std::cos(getAvgAngle());
@@ -93,19 +78,11 @@ float LidarObstacle::dangerScore() {
     return (angle_score + distance_score);
 }
 
-void LidarObstacle::mergeInReadings(std::vector<Reading>& new_readings) {
-    this->readings.insert(
-    readings.end(), new_readings.begin(), new_readings.end());
-    // Ensure that the readings are still sorted
-    std::sort(readings.begin(),
-              readings.end(),
-              [&](auto const& reading1, auto const& reading2) {
-                  return reading1.angle < reading2.angle;
-              });
+void LidarObstacle::mergeInLidarObstacle(const LidarObstacle& obstacle) {
+    // Readings from obstacles found in order of angle are just appended
+    readings.merge(obstacle.readings);
 }
 
-void LidarObstacle::mergeInLidarObstacle(LidarObstacle obstacle) {
-    // Get readings from obstacle being merged in
-    std::vector<Reading> new_readings = obstacle.getAllLaserReadings();
-    this->mergeInReadings(new_readings);
+void LidarObstacle::addReading(angle_t angle, distance_t distance) {
+    readings.add(angle, distance);
 }
@@ -0,0 +1,98 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A binary mask stored as the runs of white pixels in each row,
+ *              along with the number of white pixels in each column, so that
+ *              an image only has to be read once to answer every question
+ *              VisionDecision asks of it
+ */
+
+#include <RunLengthMask.h>
+
+// STD
+#include <algorithm>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/**
+ * Finds the first pixel at or after a column that is (or isn't) white
+ *
+ * Masks are mostly long stretches of one colour, so with SSE2 this checks
+ * 16 pixels at a time
+ *
+ * @param pixels the row of pixels to search
+ * @param column the column to start searching at
+ * @param width the number of pixels in the row
+ * @param white whether to search for a white pixel or a black one
+ * @return the column of the first pixel found, or width if there is none
+ */
+static int
+findNextPixel(const uint8_t* pixels, int column, int width, bool white) {
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    // Flips the bits of the black pixels into those of the white ones
+    const int flip = white ? 0xFFFF : 0;
+    for (; column + 16 <= width; column += 16) {
+        __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels + column));
+        int black_bits = _mm_movemask_epi8(_mm_cmpeq_epi8(block, zero));
+        int found_bits = black_bits ^ flip;
+        if (found_bits != 0) return column + __builtin_ctz(found_bits);
+    }
+#endif
+    while (column < width && (pixels[column] != 0) != white) column++;
+    return column;
+}
+
+RunLengthMask::RunLengthMask()
+  : width(0), height(0), row_starts(1, 0), column_prefix_counts(1, 0) {}
+
+RunLengthMask::RunLengthMask(const sensor_msgs::Image& image) {
+    build(image);
+}
+
+void RunLengthMask::build(const sensor_msgs::Image& image) {
+    width  = image.width;
+    height = image.height;
+    runs.clear();
+    row_starts.assign(1, 0);
+
+    // Every run adds one to the count of each of its columns, which is
+    // tracked as the change in count at its start and end column
+    std::vector<int> count_changes(width + 1, 0);
+
+    for (int row = 0; row < height; row++) {
+        const uint8_t* pixels = image.data.data() + row * image.step;
+        int column            = 0;
+        while (column < width) {
+            // Skip to the start of the next run
+            int start = findNextPixel(pixels, column, width, true);
+            if (start == width) break;
+
+            column = findNextPixel(pixels, start, width, false);
+            runs.emplace_back(PixelRun{start, column});
+            count_changes[start]++;
+            count_changes[column]--;
+        }
+        row_starts.emplace_back(runs.size());
+    }
+
+    column_prefix_counts.assign(width + 1, 0);
+    int column_count = 0;
+    for (int column = 0; column < width; column++) {
+        column_count += count_changes[column];
+        column_prefix_counts[column + 1] =
+        column_prefix_counts[column] + column_count;
+    }
+}
+
+bool RunLengthMask::isWhite(int row, int column) const {
+    // Find the first run that ends after the column
+    const PixelRun* run =
+    std::partition_point(rowBegin(row), rowEnd(row), [&](const PixelRun& r) {
+        return r.end <= column;
+    });
+    return run != rowEnd(row) && run->start <= column;
+}
@@ -6,6 +6,9 @@
  */
 #include <VisionDecision.h>
 
+// STD
+#include <algorithm>
+
 // The constructor
 VisionDecision::VisionDecision(int argc, char** argv, std::string node_name) {
     ros::init(argc, argv, node_name);
@@ -14,6 +17,16 @@ VisionDecision::VisionDecision(int argc, char** argv, std::string node_name) {
     ros::NodeHandle nh;
     ros::NodeHandle private_nh("~");
 
+    setUpNode(nh, private_nh);
+}
+
+VisionDecision::VisionDecision(ros::NodeHandle& nh,
+                               ros::NodeHandle& private_nh) {
+    setUpNode(nh, private_nh);
+}
+
+void VisionDecision::setUpNode(ros::NodeHandle& nh,
+                               ros::NodeHandle& private_nh) {
     // Setup Subscriber(s)
     std::string camera_image_topic_name = "/vision/filtered_image";
     uint32_t queue_size                 = 1;
@@ -98,22 +111,19 @@ double percent_of_samples_needed,
 double& confidence_value,
 double move_away_threshold,
 double percent_of_white_needed) {
-    int row, col;
-    int whiteCount   = 0;
     confidence_value = 0;
 
+    // Read the image once, everything below is answered from the mask
+    RunLengthMask mask(*image_scan);
+
     // Check if there is a white line in the way of the robot
-    for (row = 0; row < image_scan->height; row++) {
-        for (col = 0; col < image_scan->width; col++)
-            if (image_scan->data[row * image_scan->width + col] != 0)
-                whiteCount++;
-    }
+    int whiteCount = mask.getWhiteCount();
 
     double valid_samples;
 
     int leftToRightAngle = getAngleOfLine(false,
                                           numSamples,
-                                          image_scan,
+                                          mask,
                                           rolling_average_constant,
                                           percent_of_samples_needed,
                                           valid_samples);
@@ -125,7 +135,7 @@ double percent_of_white_needed) {
 
     double rightToLeftAngle = getAngleOfLine(true,
                                              numSamples,
-                                             image_scan,
+                                             mask,
                                              rolling_average_constant,
                                              percent_of_samples_needed,
                                              valid_samples);
@@ -146,28 +156,26 @@ double percent_of_white_needed) {
     }
 
     if (fabs(desiredAngle) <= move_away_threshold)
-        desiredAngle = moveAwayFromLine(image_scan);
+        desiredAngle = moveAwayFromLine(mask);
 
     // If there is a perpendicular line in front of the robot, stop.
-    if (isPerpendicular(image_scan)) confidence_value = 0;
+    if (isPerpendicular(mask)) confidence_value = 0;
 
     double num_of_white_needed =
     image_scan->height * image_scan->width * percent_of_white_needed;
-    if (whiteCount < num_of_white_needed)
-        desiredAngle = moveAwayFromLine(image_scan);
+    if (whiteCount < num_of_white_needed) desiredAngle = moveAwayFromLine(mask);
 
     return desiredAngle;
 }
 
-int VisionDecision::getAngleOfLine(
-bool rightSide,
-double numSamples,
-const sensor_msgs::Image::ConstPtr& image_scan,
-double rolling_average_constant,
-double percent_of_samples_needed,
-double& validSamples) {
+int VisionDecision::getAngleOfLine(bool rightSide,
+                                   double numSamples,
+                                   const RunLengthMask& mask,
+                                   double rolling_average_constant,
+                                   double percent_of_samples_needed,
+                                   double& validSamples) {
     // initialization of local variables.
-    double imageHeight = image_scan->height;
+    double imageHeight = mask.getHeight();
     int incrementer;
     int startingPos = 0;
     validSamples    = 0;
@@ -177,19 +185,17 @@ double& validSamples) {
     double x1     = -1;
 
     // Initialize how and where to parse.
-    incrementer =
-    initializeIncrementerPosition(rightSide, image_scan, &startingPos);
+    incrementer = initializeIncrementerPosition(rightSide, mask, &startingPos);
 
     // starts parsing from the right and finds where the lowest white line
     // begins.
     for (int i = imageHeight - 1; i > 0; i--) {
-        int startPixel =
-        getEdgePixel(startingPos, incrementer, i, image_scan, true);
+        int startPixel = getEdgePixel(startingPos, incrementer, i, mask, true);
         if (startPixel != -1 && bottomRow == -1) {
             // Each slope will be compared to the bottom point of the lowest
             // white line
             bottomRow = i;
-            x1 = getMiddle(startingPos, bottomRow, rightSide, image_scan);
+            x1        = getMiddle(startingPos, bottomRow, rightSide, mask);
             break;
         }
     }
@@ -204,7 +210,7 @@ double& validSamples) {
          division++) {
         double yCompared = bottomRow - division;
         double xCompared =
-        getMiddle(startingPos, (int) yCompared, rightSide, image_scan);
+        getMiddle(startingPos, (int) yCompared, rightSide, mask);
 
         double foundAngle;
         double foundSlope;
@@ -272,7 +278,7 @@ double VisionDecision::getDesiredLinearSpeed(double desiredAngle) {
 int VisionDecision::getMiddle(int startingPos,
                               int row,
                               bool rightSide,
-                              const sensor_msgs::Image::ConstPtr& image_scan) {
+                              const RunLengthMask& mask) {
     int incrementer;
     int startPixel, endPixel;
 
@@ -285,11 +291,11 @@ int VisionDecision::getMiddle(int startingPos,
 
     // Find first pixel of the white line in a certain row.
     startPixel =
-    VisionDecision::getEdgePixel(startingPos, incrementer, row, image_scan, 1);
+    VisionDecision::getEdgePixel(startingPos, incrementer, row, mask, 1);
 
     // Find last pixel of the white line in a certain row.
     endPixel =
-    VisionDecision::getEdgePixel(startPixel, incrementer, row, image_scan, 0);
+    VisionDecision::getEdgePixel(startPixel, incrementer, row, mask, 0);
 
     // Return average of the two pixels.
     return (startPixel + endPixel) / 2;
@@ -298,7 +304,7 @@ int VisionDecision::getMiddle(int startingPos,
 int VisionDecision::getEdgePixel(int startingPos,
                                  int incrementer,
                                  int row,
-                                 const sensor_msgs::Image::ConstPtr& image_scan,
+                                 const RunLengthMask& mask,
                                  bool isStartPixel) {
     // Initialization of local variables
     int column                 = startingPos;
@@ -308,44 +314,85 @@ int VisionDecision::getEdgePixel(int startingPos,
     // Initialize these to be garbage values
     int toBeChecked = -1;
 
-    // Parse through image horizontally to find a valid pixel
-    while (column < image_scan->width && column >= 0) {
-        // If white pixel found start verifying if proper start.
-        if ((image_scan->data[row * image_scan->width + column] != 0 &&
-             isStartPixel) ||
-            (image_scan->data[row * image_scan->width + column] == 0 &&
-             !isStartPixel)) {
-            blackVerificationCount = 0;
-            // This pixel is what we are checking
-            if (toBeChecked == -1) { toBeChecked = column; }
-
-            // Determine whether toBeChecked is noise
-            whiteVerificationCount++;
-            if (whiteVerificationCount == NOISE_MAX) return toBeChecked;
-        } else {
-            blackVerificationCount++;
-            if (blackVerificationCount >= NOISE_MAX) {
-                whiteVerificationCount =
-                0; // Reset verification if black pixel.
-                toBeChecked = -1;
-            }
+    // Parse through the row a stretch of same coloured pixels at a time,
+    // alternating between the runs of white pixels and the gaps between them
+    const PixelRun* rowBegin = mask.rowBegin(row);
+    const PixelRun* rowEnd   = mask.rowEnd(row);
+    if (incrementer > 0) {
+        // The first run that ends after the starting column
+        const PixelRun* run = rowBegin;
+        while (run != rowEnd && run->end <= column) run++;
+
+        while (column < mask.getWidth() && column >= 0) {
+            bool isWhite = run != rowEnd && run->start <= column;
+            int stretchEnd =
+            isWhite ? run->end : (run != rowEnd ? run->start : mask.getWidth());
+            if (verifyEdgeStretch(isWhite == isStartPixel,
+                                  column,
+                                  stretchEnd - column,
+                                  whiteVerificationCount,
+                                  blackVerificationCount,
+                                  toBeChecked))
+                return toBeChecked;
+            if (isWhite) run++;
+            column = stretchEnd;
+        }
+    } else {
+        // One past the last run that starts at or before the starting column
+        const PixelRun* run = rowEnd;
+        while (run != rowBegin && (run - 1)->start > column) run--;
+
+        while (column < mask.getWidth() && column >= 0) {
+            bool isWhite = run != rowBegin && column < (run - 1)->end;
+            int stretchStart =
+            isWhite ? (run - 1)->start : (run != rowBegin ? (run - 1)->end : 0);
+            if (verifyEdgeStretch(isWhite == isStartPixel,
+                                  column,
+                                  column - stretchStart + 1,
+                                  whiteVerificationCount,
+                                  blackVerificationCount,
+                                  toBeChecked))
+                return toBeChecked;
+            if (isWhite) run--;
+            column = stretchStart - 1;
         }
-        // Go to next element
-        column += incrementer;
     }
 
     // No value found return an error.
     return -1;
 }
 
-int VisionDecision::initializeIncrementerPosition(
-bool rightSide,
-const sensor_msgs::Image::ConstPtr& image_scan,
-int* startingPos) {
+bool VisionDecision::verifyEdgeStretch(bool isTarget,
+                                       int firstPos,
+                                       int length,
+                                       int& targetCount,
+                                       int& otherCount,
+                                       int& toBeChecked) {
+    if (isTarget) {
+        otherCount = 0;
+        // The first pixel is what we are checking
+        if (toBeChecked == -1) { toBeChecked = firstPos; }
+
+        // Determine whether toBeChecked is noise
+        targetCount += length;
+        return targetCount >= NOISE_MAX;
+    }
+
+    otherCount += length;
+    if (otherCount >= NOISE_MAX) {
+        targetCount = 0; // Reset verification if enough of the other colour.
+        toBeChecked = -1;
+    }
+    return false;
+}
+
+int VisionDecision::initializeIncrementerPosition(bool rightSide,
+                                                  const RunLengthMask& mask,
+                                                  int* startingPos) {
     // Decides how to parse depending on if rightSide is true or false.
     if (rightSide) {
         // starts at right side then increments to the left
-        *startingPos = image_scan->width - 1;
+        *startingPos = mask.getWidth() - 1;
         return -1;
     } else {
         // starts at left side then increments to th right
@@ -354,29 +401,28 @@ int* startingPos) {
     }
 }
 
-bool VisionDecision::isPerpendicular(
-const sensor_msgs::Image::ConstPtr& image_scan) {
+bool VisionDecision::isPerpendicular(const RunLengthMask& mask) {
     int leftSidePixel, rightSidePixel = -1;
     int i, j;
 
-    for (i = 0; i < image_scan->width; i++) {
-        leftSidePixel = getVerticalEdgePixel(image_scan, i);
+    for (i = 0; i < mask.getWidth(); i++) {
+        leftSidePixel = getVerticalEdgePixel(mask, i);
         if (leftSidePixel != -1) break;
     }
 
-    for (j = image_scan->width - 1; j > 0; j--) {
-        rightSidePixel = getVerticalEdgePixel(image_scan, j);
+    for (j = mask.getWidth() - 1; j > 0; j--) {
+        rightSidePixel = getVerticalEdgePixel(mask, j);
         if (rightSidePixel != -1) break;
     }
 
     if (rightSidePixel == 0 && leftSidePixel == 0) return 0;
 
-    return (fabs(rightSidePixel - leftSidePixel) < image_scan->height / 10 &&
-            fabs(j - i) > image_scan->width / 10);
+    return (fabs(rightSidePixel - leftSidePixel) < mask.getHeight() / 10 &&
+            fabs(j - i) > mask.getWidth() / 10);
 }
 
-int VisionDecision::getVerticalEdgePixel(
-const sensor_msgs::Image::ConstPtr& image_scan, int column) {
+int VisionDecision::getVerticalEdgePixel(const RunLengthMask& mask,
+                                         int column) {
     int row;
     int whiteVerificationCount = 0;
     int blackVerificationCount = 0;
@@ -384,10 +430,13 @@ const sensor_msgs::Image::ConstPtr& image_scan, int column) {
     // Initialize these to be garbage values
     int toBeChecked = -1;
 
+    // A column without enough white pixels can't have a valid one
+    if (mask.getColumnWhiteCount(column) < NOISE_MAX) return -1;
+
     // Parse vertically to find a valid starting white pixel.
-    for (row = image_scan->height - 1; row >= 0; row--) {
+    for (row = mask.getHeight() - 1; row >= 0; row--) {
         // If white pixel found start verifying if proper start.
-        if ((image_scan->data[row * image_scan->width + column] != 0)) {
+        if (mask.isWhite(row, column)) {
             blackVerificationCount = 0;
             // This pixel is what we are checking
             if (toBeChecked == -1) toBeChecked = row;
@@ -404,31 +453,22 @@ const sensor_msgs::Image::ConstPtr& image_scan, int column) {
             }
         }
     }
+
+    // No value found return an error.
+    return -1;
 }
 
-int VisionDecision::getLeftToRightPixelRatio(
-const sensor_msgs::Image::ConstPtr& image_scan) {
-    int leftCount  = 0;
-    int rightCount = 0;
-
-    for (int row = 0; row < image_scan->height; row++) {
-        for (int column = 0; column < image_scan->width; column++) {
-            if (image_scan->data[row * image_scan->width + column] != 0 &&
-                column <= image_scan->width / 2) {
-                leftCount++;
-            }
-            if (image_scan->data[row * image_scan->width + column] != 0 &&
-                column > image_scan->width / 2)
-                rightCount++;
-        }
-    }
+int VisionDecision::getLeftToRightPixelRatio(const RunLengthMask& mask) {
+    // The middle column counts towards the left
+    int leftEnd    = std::min(mask.getWidth() / 2 + 1, mask.getWidth());
+    int leftCount  = mask.getWhiteCountInColumns(0, leftEnd);
+    int rightCount = mask.getWhiteCount() - leftCount;
 
     return rightCount - leftCount;
 }
 
-int VisionDecision::moveAwayFromLine(
-const sensor_msgs::Image::ConstPtr& image_scan) {
-    if (getLeftToRightPixelRatio(image_scan) < 0)
+int VisionDecision::moveAwayFromLine(const RunLengthMask& mask) {
+    if (getLeftToRightPixelRatio(mask) < 0)
         return 45;
     else
         return -45;
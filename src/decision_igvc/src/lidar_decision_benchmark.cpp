@@ -0,0 +1,56 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Replays recorded LaserScans through
+ *              LidarDecision::findObstacles and prints the latency of each
+ *              scan as a histogram
+ *
+ * Usage: rosrun decision_igvc lidar_decision_benchmark
+ *            <scans.bag|scans.dump> [repeats] [topic]
+ */
+
+#include <LaserScanReplay.h>
+#include <LidarDecision.h>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace snowbots;
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr,
+                "Usage: %s <scans.bag|scans.dump> [repeats] [topic]\n",
+                argv[0]);
+        return 1;
+    }
+
+    unsigned int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    std::string topic    = argc > 3 ? argv[3] : "";
+
+    std::vector<sensor_msgs::LaserScan> scans;
+    if (!loadLaserScans(argv[1], topic, scans) || scans.empty()) {
+        fprintf(stderr, "Could not load any scans from %s\n", argv[1]);
+        return 1;
+    }
+
+    // The angle is the default in lidar_decision.launch
+    float max_obstacle_angle_diff    = M_PI / 36;
+    float max_obstacle_distance_diff = 1.0;
+
+    size_t total_obstacles     = 0;
+    LatencyHistogram histogram = timeScans(
+    "findObstacles", scans, repeats, [&](const sensor_msgs::LaserScan& scan) {
+        total_obstacles +=
+        LidarDecision::findObstacles(
+        scan, max_obstacle_angle_diff, max_obstacle_distance_diff)
+        .size();
+    });
+
+    printf("%zu scans of %zu beams, %.2f obstacles per scan\n\n",
+           scans.size(),
+           scans[0].ranges.size(),
+           (double) total_obstacles / ((repeats + 1) * scans.size()));
+    histogram.print();
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which produces a recommended twist message from
+ *              a filtered image, see VisionDecision. Loaded into the same
+ *              manager as the sb_vision nodelets, it gets their images
+ *              without them being serialized.
+ */
+
+#include <pluginlib/class_list_macros.h>
+#include <vision_decision_nodelet.h>
+
+using namespace decision_igvc;
+
+VisionDecisionNodelet::VisionDecisionNodelet() {}
+
+void VisionDecisionNodelet::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    node.reset(new VisionDecision(getNodeHandle(), getPrivateNodeHandle()));
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(decision_igvc::VisionDecisionNodelet, nodelet::Nodelet)
@@ -139,6 +139,35 @@ TEST_F(LidarDecisionTest, findObstaclesAngleTest) {
     }
 }
 
+// findObstacles should give the same obstacles as merging one obstacle per
+// lidar hit with mergeSimilarObstacles
+TEST_F(LidarDecisionTest, findObstaclesMatchesMergeSimilarObstacles) {
+    sensor_msgs::LaserScan scan = scan1;
+    for (size_t i = 0; i < scan.ranges.size(); i++) {
+        scan.ranges[i] = 19 + (i * 7919 % 23);
+    }
+
+    std::vector<LidarObstacle> expected;
+    for (size_t i = 0; i < scan.ranges.size(); i++) {
+        if (scan.ranges[i] < scan.range_max &&
+            scan.ranges[i] > scan.range_min) {
+            expected.emplace_back(scan.angle_increment * i + scan.angle_min,
+                                  scan.ranges[i]);
+        }
+    }
+    LidarDecision::mergeSimilarObstacles(expected, 0.02, 5.0);
+
+    std::vector<LidarObstacle> found_obstacles =
+    LidarDecision::findObstacles(scan, 0.02, 5.0);
+    ASSERT_EQ(expected.size(), found_obstacles.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].getAllLaserReadings().size(),
+                  found_obstacles[i].getAllLaserReadings().size());
+        EXPECT_FLOAT_EQ(expected[i].getMinAngle(),
+                        found_obstacles[i].getMinAngle());
+    }
+}
+
 TEST_F(LidarDecisionTest, angular_twist_message_from_obstacleTest) {
     // Check that the correct twist.angular.z values are calculated
     // based on test obstacle's parameters
@@ -0,0 +1,111 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for RunLengthMask
+ */
+
+#include <RunLengthMask.h>
+#include <gtest/gtest.h>
+
+class RunLengthMaskTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        // A 6x3 image, where # is white
+        std::string pixels =
+        ".##..#"
+        "......"
+        "######";
+        image.width  = 6;
+        image.height = 3;
+        image.step   = 6;
+        for (char pixel : pixels) {
+            image.data.push_back(pixel == '#' ? 255 : 0);
+        }
+    }
+
+    sensor_msgs::Image image;
+};
+
+TEST_F(RunLengthMaskTest, rowRuns) {
+    RunLengthMask mask(image);
+    EXPECT_EQ(6, mask.getWidth());
+    EXPECT_EQ(3, mask.getHeight());
+
+    ASSERT_EQ(2, mask.rowEnd(0) - mask.rowBegin(0));
+    EXPECT_EQ(1, mask.rowBegin(0)[0].start);
+    EXPECT_EQ(3, mask.rowBegin(0)[0].end);
+    EXPECT_EQ(5, mask.rowBegin(0)[1].start);
+    EXPECT_EQ(6, mask.rowBegin(0)[1].end);
+
+    EXPECT_EQ(mask.rowBegin(1), mask.rowEnd(1));
+
+    ASSERT_EQ(1, mask.rowEnd(2) - mask.rowBegin(2));
+    EXPECT_EQ(0, mask.rowBegin(2)[0].start);
+    EXPECT_EQ(6, mask.rowBegin(2)[0].end);
+}
+
+TEST_F(RunLengthMaskTest, isWhite) {
+    RunLengthMask mask(image);
+    for (int row = 0; row < image.height; row++) {
+        for (int column = 0; column < image.width; column++) {
+            EXPECT_EQ(image.data[row * image.step + column] != 0,
+                      mask.isWhite(row, column));
+        }
+    }
+}
+
+TEST_F(RunLengthMaskTest, whiteCounts) {
+    RunLengthMask mask(image);
+    EXPECT_EQ(9, mask.getWhiteCount());
+    EXPECT_EQ(1, mask.getWhiteCountInColumns(0, 1));
+    EXPECT_EQ(2, mask.getWhiteCountInColumns(1, 2));
+    EXPECT_EQ(5, mask.getWhiteCountInColumns(0, 3));
+    EXPECT_EQ(4, mask.getWhiteCountInColumns(3, 6));
+}
+
+TEST_F(RunLengthMaskTest, wideRows) {
+    // Runs of all lengths, crossing and lining up with the 16 pixel blocks
+    // searched at once
+    image.data.clear();
+    image.width  = 100;
+    image.height = 4;
+    image.step   = 100;
+    bool white   = false;
+    for (int i = 0; image.data.size() < 400; i++) {
+        for (int j = 0; j < (i * 7) % 37 + 1; j++) {
+            image.data.push_back(white ? 255 : 0);
+        }
+        white = !white;
+    }
+    image.data.resize(400);
+
+    RunLengthMask mask(image);
+    int white_count = 0;
+    for (int column = 0; column < image.width; column++) {
+        int column_count = 0;
+        for (int row = 0; row < image.height; row++) {
+            bool is_white = image.data[row * image.step + column] != 0;
+            EXPECT_EQ(is_white, mask.isWhite(row, column));
+            column_count += is_white;
+        }
+        EXPECT_EQ(column_count, mask.getColumnWhiteCount(column));
+        white_count += column_count;
+    }
+    EXPECT_EQ(white_count, mask.getWhiteCount());
+}
+
+TEST_F(RunLengthMaskTest, rebuild) {
+    RunLengthMask mask(image);
+
+    image.data.assign(image.data.size(), 0);
+    mask.build(image);
+    EXPECT_EQ(0, mask.getWhiteCount());
+    for (int row = 0; row < image.height; row++) {
+        EXPECT_EQ(mask.rowBegin(row), mask.rowEnd(row));
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,115 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A map of the cones seen across scans, kept in the odometry
+ *              frame so it stays put while the robot moves. Cones are
+ *              refined with every scan they are seen in and forgotten after
+ *              going unseen for a while, and the cone lines are only refit
+ *              when the cones in the map change
+ */
+
+#ifndef DRAG_RACE_IARRC_CONEMAP_H
+#define DRAG_RACE_IARRC_CONEMAP_H
+
+// STD Includes
+#include <vector>
+
+// Snowbots Includes
+#include <LidarObstacleManager.h>
+#include <LineStatsAccumulator.h>
+#include <PointGrouper.h>
+#include <SpatialHash.h>
+
+struct MappedCone {
+    // The center of the cone, in the odometry frame
+    Point center;
+
+    // The number of scans the cone has been seen in
+    unsigned int hits;
+
+    // The number of scans in a row the cone has not been seen in
+    unsigned int missed_scans;
+};
+
+class ConeMap {
+  public:
+    /**
+     * Creates an empty ConeMap
+     *
+     * @param max_merging_distance the furthest a cone can be seen from where
+     * a mapped cone is for it to be the same cone
+     * @param cone_grouping_tolerance the maximum distance between
+     * neighbouring cones in the same line
+     * @param min_hits the number of scans a cone has to be seen in before it
+     * is used for the cone lines
+     * @param max_missed_scans the number of scans in a row a cone can go
+     * unseen before it is forgotten
+     */
+    ConeMap(double max_merging_distance    = 0.3,
+            double cone_grouping_tolerance = 1.8,
+            unsigned int min_hits          = 2,
+            unsigned int max_missed_scans  = 10);
+
+    /**
+     * Updates the map with the cones seen in a scan
+     *
+     * @param scan_cones the centers of the cones seen, in the robot's frame
+     * @param robot_x the x position of the robot in the odometry frame
+     * @param robot_y the y position of the robot in the odometry frame
+     * @param robot_yaw the heading of the robot in the odometry frame
+     */
+    void update(const std::vector<Point>& scan_cones,
+                double robot_x,
+                double robot_y,
+                double robot_yaw);
+
+    /**
+     * Gets the lines through the groups of cones in the map, in the robot's
+     * frame as of the last update
+     *
+     * @return the lines through the groups of cones in the map
+     */
+    std::vector<LineOfBestFit> getConeLines() const;
+
+    /**
+     * @return all cones in the map
+     */
+    const std::vector<MappedCone>& getCones() const { return cones; }
+
+    /**
+     * Forgets all cones
+     */
+    void clear();
+
+  private:
+    /**
+     * Finds the groups of cones that have enough hits, and the statistics of
+     * the line through each
+     */
+    void refitConeLines();
+
+    double max_merging_distance;
+    double cone_grouping_tolerance;
+    unsigned int min_hits;
+    unsigned int max_missed_scans;
+
+    std::vector<MappedCone> cones;
+
+    // The statistics of the line through each group of cones, in the
+    // odometry frame
+    std::vector<LineStatsAccumulator> cone_line_stats;
+
+    // The robot's pose as of the last update
+    double robot_x;
+    double robot_y;
+    double robot_yaw;
+
+    // Reused by update: the mapped cones hashed by their center, and which
+    // mapped cones have been seen in the scan
+    SpatialHash cone_centers;
+    std::vector<bool> seen;
+
+    PointGrouper point_grouper;
+};
+
+#endif // DRAG_RACE_IARRC_CONEMAP_H
@@ -16,12 +16,15 @@
 // ROS Includes
 // TODO: Sort me for neatness
 #include <geometry_msgs/Twist.h>
+#include <nav_msgs/Odometry.h>
 #include <ros/ros.h>
 #include <sensor_msgs/LaserScan.h>
 #include <std_msgs/Bool.h>
 #include <std_msgs/String.h>
+#include <tf/transform_datatypes.h>
 
 // SB Includes
+#include <ConeMap.h>
 #include <DragRaceController.h>
 #include <LidarObstacleManager.h>
 #include <sb_utils.h>
@@ -36,9 +39,26 @@ class DragRaceNode {
 
     void greenLightCallBack(const std_msgs::Bool& green_light_detected);
 
+    /**
+     * Saves the robot's latest pose, which the cone map is kept relative to
+     *
+     * @param odom the robot's odometry
+     */
+    void odomCallBack(const nav_msgs::Odometry::ConstPtr& odom);
+
     // Manages obstacles, including the cones and wall
     LidarObstacleManager obstacle_manager;
 
+    // Remembers cones across scans, if use_cone_map is set. Otherwise the
+    // cone lines come from each scan on its own
+    ConeMap cone_map;
+    bool use_cone_map;
+
+    // The robot's latest pose, in the odometry frame
+    double robot_x;
+    double robot_y;
+    double robot_yaw;
+
     // Manages line handling and movement
     DragRaceController drag_race_controller;
 
@@ -82,6 +102,8 @@ class DragRaceNode {
     ros::Subscriber scan_subscriber;
     // Subscribes to traffic light detection
     ros::Subscriber traffic_light_subscriber;
+    // Subscribes to the robot's odometry, for the cone map
+    ros::Subscriber odom_subscriber;
 
     // Publishes Twist messages to control the robot
     ros::Publisher twist_publisher;
@@ -12,6 +12,9 @@
 #include <algorithm>
 #include <vector>
 
+// Snowbots
+#include <ObstacleReadings.h>
+
 using distance_t = double;
 using angle_t    = double;
 
@@ -84,12 +87,25 @@ class LidarObstacle {
      */
     LidarObstacle(double min_wall_length, std::vector<Reading> readings);
 
+    /**
+     * Creates a LidarObstacle from a single reading, whose point has already
+     * been computed (ie. by a snowbots::LaserScanProjector)
+     *
+     * @param min_wall_length the minimum length for the obstacle to be
+     * considered a wall
+     * @param reading the reading to initialize the obstacle with
+     * @param point the point interpretation of the reading
+     */
+    LidarObstacle(double min_wall_length,
+                  const Reading& reading,
+                  const Point& point);
+
     /**
     * Gets the distance to the rightmost point of the Obstacle
     *
     * @return the distance to the rightmost point of the Obstacle
     */
-    distance_t getFirstDistance();
+    distance_t getFirstDistance() const;
 
     /**
     * Gets the distance to the leftmost point of the Obstacle
@@ -97,7 +113,7 @@ class LidarObstacle {
     * @return the distance to the leftmost point of the obstacle
     */
 
-    distance_t getLastDistance();
+    distance_t getLastDistance() const;
     /**
      * Gets the average distance of the Obstacle from the robot
      *
@@ -105,7 +121,7 @@ class LidarObstacle {
      *
      * @return the distance of the Obstacle from the robot
      */
-    double getAvgDistance();
+    double getAvgDistance() const;
 
     /**
      * Gets the angle of the Obstacle from the robot
@@ -114,42 +130,45 @@ class LidarObstacle {
      *
      * @return the angle of the Obstacle from the robot
      */
-    double getAvgAngle();
+    double getAvgAngle() const;
 
     /**
      * Gets the minimum angle from of an object from the robot
      *
      * @return the minimum angle of the obstacle from the robot
      */
-    double getMinAngle();
+    double getMinAngle() const;
 
     /**
      * Gets the maximum angle from of an object from the robot
      *
      * @return the maximum angle of the obstacle from the robot
      */
-    double getMaxAngle();
+    double getMaxAngle() const;
 
     /**
      * Gets the minimum distance from of an object from the robot
      *
      * @return the minimum distance of the obstacle from the robot
      */
-    double getMinDistance();
+    double getMinDistance() const;
 
     /**
      * Gets the maximum distance from of an object from the robot
      *
      * @return the maximum distance of the obstacle from the robot
      */
-    double getMaxDistance();
+    double getMaxDistance() const;
 
     /**
      * Gets all laser readings comprising the obstacle
      *
+     * The readings are stored as separate arrays of angles and ranges, so
+     * this builds a copy of them
+     *
      * @return readings A list of pairs of all laser readings
      */
-    const std::vector<Reading>& getAllLaserReadings();
+    std::vector<Reading> getAllLaserReadings() const;
 
     /**
      * Merges the given LidarObstacle in to this LidarObstacle
@@ -159,14 +178,14 @@ class LidarObstacle {
      *
      * @param obstacle The LidarObstacle to be merged in
      */
-    void mergeInLidarObstacle(LidarObstacle& obstacle);
+    void mergeInLidarObstacle(const LidarObstacle& obstacle);
 
     /**
      * Gets the type of the this obstacle
      *
      * @return the type of this obstacle
      */
-    ObstacleType getObstacleType();
+    ObstacleType getObstacleType() const;
 
     /**
      * Determines and sets what the obstacle type should be
@@ -183,21 +202,24 @@ class LidarObstacle {
      */
     // TODO: This is a terrible definition. A reading slightly to the right of
     // the leftmost reading could have infited range
-    double getLength();
+    double getLength() const;
 
     /**
      * Get the minimum length for this obstacle to be considered a wall
      *
      * @return the minimum length for this obstacle to be considered a wall
      */
-    double getMinWallLength();
+    double getMinWallLength() const;
 
     /**
      * Gets the readings composing this obstacle as 2D Points
      *
-     * @return readings composing this obstacle as 2D Points
+     * The points are computed once, when readings are added
+     *
+     * @return readings composing this obstacle as 2D Points, in the same
+     * order as the readings
      */
-    std::vector<Point> getReadingsAsPoints();
+    const std::vector<Point>& getReadingsAsPoints() const;
 
     /**
      * Computes a (x,y) point from a given reading
@@ -211,17 +233,18 @@ class LidarObstacle {
      * Gets the center of the obstacle
      * @return the center of the obstacle
      */
-    Point getCenter();
+    Point getCenter() const;
 
     // TODO: Write functions for modeling obstacles as circles and squares to
     // reduce comparison times
   private:
     /**
-     * Merges a given set of readings into the obstacle
+     * Adds a reading to the obstacle, keeping the readings sorted
      *
-     * @param readings the readings to be merged in
+     * @param reading the reading to add
+     * @param point the point interpretation of the reading
      */
-    void mergeInReadings(std::vector<Reading>& new_readings);
+    void addReading(const Reading& reading, const Point& point);
 
     /**
      * Updates the center of the obstacle based on our current readings
@@ -231,7 +254,13 @@ class LidarObstacle {
     // The distances and angles of all the laser scan hits that comprise the
     // object.
     // readings are stored in sorted order, from min to max angle.
-    std::vector<Reading> readings;
+    snowbots::ObstacleReadings<double> readings;
+
+    // The readings as points, in the same order as the readings
+    std::vector<Point> points;
+
+    // The sum of all points, for finding the center
+    Point point_sum;
 
     // The type of the obstacle
     ObstacleType obstacle_type;
@@ -15,7 +15,11 @@
 #include <visualization_msgs/Marker.h>
 
 // SB Includes
+#include <LaserScanProjector.h>
 #include <LidarObstacle.h>
+#include <LineStatsAccumulator.h>
+#include <PointGrouper.h>
+#include <SpatialHash.h>
 
 class SlopeInterceptLine {
   public:
@@ -23,20 +27,22 @@ class SlopeInterceptLine {
       : slope(slope), y_intercept(y_intercept) {}
 
     // TODO: DOC functions
-    inline double getSlope() { return slope; }
+    inline double getSlope() const { return slope; }
 
-    inline double getYIntercept() { return y_intercept; }
+    inline double getYIntercept() const { return y_intercept; }
 
-    inline double getXIntercept() { return -y_intercept / slope; }
+    inline double getXIntercept() const { return -y_intercept / slope; }
 
-    inline double getXCoorAtY(double y) {
+    inline double getXCoorAtY(double y) const {
         if (slope == 0)
             return y_intercept;
         else
             return (y - y_intercept) / slope;
     }
 
-    inline double getYCoorAtX(double x) { return slope * x + y_intercept; }
+    inline double getYCoorAtX(double x) const {
+        return slope * x + y_intercept;
+    }
 
   protected:
     double slope;
@@ -80,6 +86,10 @@ class LidarObstacleManager {
     /**
      * Merges or adds the given obstacle to the already saved ones
      *
+     * The obstacle is merged into the first saved obstacle (in the order they
+     * were added) that has a point within max_obstacle_merging_distance of
+     * one of its points, or added if there is no such obstacle
+     *
      * @param obstacle the obstacle to be added
      */
     void addObstacle(LidarObstacle obstacle);
@@ -112,7 +122,13 @@ class LidarObstacleManager {
      * Gets all obstacles
      * @return all saved obstacles
      */
-    std::vector<LidarObstacle> getObstacles();
+    const std::vector<LidarObstacle>& getObstacles() const;
+
+    /**
+     * Gets the centers of all cones in the saved obstacles
+     * @return the centers of all cones in the saved obstacles
+     */
+    std::vector<Point> getConeCenters();
 
     /**
      * Gets all lines of cones in the saved obstacles
@@ -127,8 +143,28 @@ class LidarObstacleManager {
      */
     static LineOfBestFit getLineOfBestFit(const std::vector<Point>& points);
 
+    /**
+     * Gets a line of best fit from the accumulated statistics of a group of
+     * points
+     *
+     * @param stats the statistics of the points to fit the line to
+     */
+    static LineOfBestFit getLineOfBestFit(const LineStatsAccumulator& stats);
+
     LineOfBestFit getBestLine(bool lineToTheRight);
 
+    /**
+     * Picks the line on the given side with the strongest correlation that is
+     * close enough to the robot
+     *
+     * @param lines the lines to choose from
+     * @param lineToTheRight whether to look for a line to the right
+     * @return the best line, or a line with a correlation of 0 if none of the
+     * lines are acceptable
+     */
+    LineOfBestFit getBestLine(const std::vector<LineOfBestFit>& lines,
+                              bool lineToTheRight);
+
     /**
      * Finds groups of points within a larger group of points
      *
@@ -137,8 +173,25 @@ class LidarObstacleManager {
      *
      * @return a vector of groups of points (as vectors)
      */
-    std::vector<std::vector<Point>> getPointGroupings(std::vector<Point> points,
-                                                      double tolerance);
+    std::vector<std::vector<Point>>
+    getPointGroupings(const std::vector<Point>& points, double tolerance);
+
+    /**
+     * Finds groups of points within a larger group of points, as the indices
+     * of the points in each group
+     *
+     * Two points are in the same group if they are closer than the tolerance,
+     * or are both connected to the same group by such points
+     *
+     * @param points the points to find the groups in
+     * @param tolerance the maximum distance between neighbouring points in a
+     * group
+     *
+     * @return the indices (into points) of each group, in ascending order,
+     * with the groups ordered by their first index
+     */
+    std::vector<std::vector<size_t>>
+    getPointGroupIndices(const std::vector<Point>& points, double tolerance);
 
     /**
      * Determines the minimum distance between two obstacles
@@ -147,8 +200,8 @@ class LidarObstacleManager {
      * @param obstacle2
      * @return the minimum distance between obstacle1 and obstacle2
      */
-    static double minDistanceBetweenObstacles(LidarObstacle obstacle1,
-                                              LidarObstacle obstacle2);
+    static double minDistanceBetweenObstacles(const LidarObstacle& obstacle1,
+                                              const LidarObstacle& obstacle2);
 
     /**
      * Gets all stored obstacles as a marker of points that can be rendered in
@@ -174,6 +227,15 @@ class LidarObstacleManager {
     // TODO: TEST ME
     visualization_msgs::Marker getConeLinesRVizMarker();
 
+    /**
+     * Gets the given lines as a marker of lines that can be rendered in RViz
+     *
+     * @param cone_lines the lines to render
+     * @return the lines as a marker that can be rendered in RViz
+     */
+    static visualization_msgs::Marker
+    getConeLinesRVizMarker(const std::vector<LineOfBestFit>& cone_lines);
+
     /**
      * Gets the "best" line from all the cone lines as a marker we can visualize
      * in RViz
@@ -187,6 +249,17 @@ class LidarObstacleManager {
     visualization_msgs::Marker
     getBestConeLineRVizMarker(bool line_to_the_right);
 
+    /**
+     * Gets the "best" of the given lines as a marker we can visualize in RViz
+     *
+     * @param cone_lines the lines to choose from
+     * @param line_to_the_right whether to prefer a line to the right
+     * @return the best line as a marker that can be rendered in RViz
+     */
+    visualization_msgs::Marker
+    getBestConeLineRVizMarker(const std::vector<LineOfBestFit>& cone_lines,
+                              bool line_to_the_right);
+
     bool collisionDetected();
 
   private:
@@ -224,6 +297,15 @@ class LidarObstacleManager {
     // same
     double max_obstacle_merging_distance;
 
+    // The points of all saved obstacles, each with the index of its obstacle,
+    // hashed by cells of max_obstacle_merging_distance
+    SpatialHash obstacle_points;
+
+    // The obstacle the last added obstacle was merged into (or became), and
+    // the last point of the added obstacle
+    size_t last_obstacle;
+    Point last_point;
+
     // The maximum distance a line can have from the robot on the y-axis before
     // being thrown out
     double max_distance_from_robot_accepted;
@@ -231,11 +313,19 @@ class LidarObstacleManager {
     // The maximum permitted distance between cones in the same group
     double cone_grouping_tolerance;
 
+    // Finds the groups for getPointGroupIndices, reusing its memory
+    PointGrouper point_grouper;
+
     // The mimimum length of an obstacle before it's considered a wall
     double min_wall_length;
 
     // True if there is an obstacle within collision_distance away
     bool collision_detected;
+
+    // Converts scans to points with cached sin/cos tables
+    snowbots::LaserScanProjector projector;
+    std::vector<double> scan_x;
+    std::vector<double> scan_y;
 };
 
 #endif // DRAG_RACE_LIDAROBSTACLEMANAGER_H
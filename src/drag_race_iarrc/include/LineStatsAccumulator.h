@@ -0,0 +1,101 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Accumulates the statistics needed for a line of best fit
+ *              through a set of points in a single pass, using Welford's
+ *              method so the result stays accurate for points far from the
+ *              origin
+ */
+
+#ifndef DRAG_RACE_IARRC_LINESTATSACCUMULATOR_H
+#define DRAG_RACE_IARRC_LINESTATSACCUMULATOR_H
+
+// STD Includes
+#include <cstddef>
+
+// Snowbots Includes
+#include <LidarObstacle.h>
+
+class LineStatsAccumulator {
+  public:
+    /**
+     * Creates a LineStatsAccumulator with no points
+     */
+    LineStatsAccumulator();
+
+    /**
+     * Adds a point to the statistics
+     *
+     * @param point the point to add
+     */
+    void add(const Point& point);
+
+    /**
+     * Adds all the points accumulated by another LineStatsAccumulator, as if
+     * they had been added to this one
+     *
+     * @param other the accumulator to merge in
+     */
+    void merge(const LineStatsAccumulator& other);
+
+    /**
+     * Removes all points
+     */
+    void clear();
+
+    /**
+     * Moves all the accumulated points as if each had been rotated by the
+     * given angle about the origin, then translated by (dx, dy)
+     *
+     * @param angle the angle to rotate by, counter-clockwise in radians
+     * @param dx the distance to move along the x-axis after rotating
+     * @param dy the distance to move along the y-axis after rotating
+     */
+    void transform(double angle, double dx, double dy);
+
+    /**
+     * @return the number of points added
+     */
+    size_t count() const { return num_points; }
+
+    double getMeanX() const { return mean_x; }
+
+    double getMeanY() const { return mean_y; }
+
+    /**
+     * Gets the slope of the least squares line through the points
+     *
+     * @return the slope of the line of best fit, which is not finite if all
+     * points have the same x
+     */
+    double getSlope() const;
+
+    /**
+     * Gets the y-intercept of the least squares line through the points
+     *
+     * @return the y-intercept of the line of best fit
+     */
+    double getYIntercept() const;
+
+    /**
+     * Gets the correlation coefficient of the points
+     *
+     * @return the correlation coefficient, from -1 to 1, which is not finite
+     * if all points have the same x or the same y
+     */
+    double getCorrelation() const;
+
+  private:
+    size_t num_points;
+
+    double mean_x;
+    double mean_y;
+
+    // Sums of the squared differences of x and y from their means, and of the
+    // products of both differences
+    double x_deviation_squared_sum;
+    double y_deviation_squared_sum;
+    double xy_deviation_product_sum;
+};
+
+#endif // DRAG_RACE_IARRC_LINESTATSACCUMULATOR_H
@@ -0,0 +1,46 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Groups points that are connected by points closer than a
+ *              tolerance, using a spatial hash and a union-find
+ */
+
+#ifndef DRAG_RACE_IARRC_POINTGROUPER_H
+#define DRAG_RACE_IARRC_POINTGROUPER_H
+
+// STD Includes
+#include <vector>
+
+// Snowbots Includes
+#include <LidarObstacle.h>
+#include <SpatialHash.h>
+
+class PointGrouper {
+  public:
+    PointGrouper();
+
+    /**
+     * Finds groups of points within a larger group of points, as the indices
+     * of the points in each group
+     *
+     * Two points are in the same group if they are closer than the tolerance,
+     * or are both connected to the same group by such points
+     *
+     * @param points the points to find the groups in
+     * @param tolerance the maximum distance between neighbouring points in a
+     * group
+     *
+     * @return the indices (into points) of each group, in ascending order,
+     * with the groups ordered by their first index
+     */
+    std::vector<std::vector<size_t>> group(const std::vector<Point>& points,
+                                           double tolerance);
+
+  private:
+    // Reused between calls: the points hashed by cells of the tolerance, and
+    // the union-find parent of each point
+    SpatialHash hash;
+    std::vector<size_t> parents;
+};
+
+#endif // DRAG_RACE_IARRC_POINTGROUPER_H
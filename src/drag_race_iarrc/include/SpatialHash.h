@@ -0,0 +1,105 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A spatial hash of points, for finding every point near a
+ *              given one without comparing it to all of them
+ */
+
+#ifndef DRAG_RACE_IARRC_SPATIALHASH_H
+#define DRAG_RACE_IARRC_SPATIALHASH_H
+
+// STD Includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// Snowbots Includes
+#include <LidarObstacle.h>
+
+class SpatialHash {
+  public:
+    /**
+     * Creates an empty SpatialHash
+     *
+     * @param cell_size the size of a grid cell, which is the furthest a point
+     * can be searched for around another
+     */
+    SpatialHash(double cell_size);
+
+    /**
+     * Removes all points, keeping the memory used for them
+     */
+    void clear();
+
+    /**
+     * Changes the size of the grid cells, removing all points
+     *
+     * @param cell_size the new size of a grid cell
+     */
+    void setCellSize(double cell_size);
+
+    /**
+     * Adds a point, along with a value to find it by
+     *
+     * @param point the point to add
+     * @param value the value to store with the point (ie. an index)
+     */
+    void insert(const Point& point, size_t value);
+
+    /**
+     * Calls visit(point, value) once for every point that was added in the
+     * 3x3 grid cells around the given point, which includes every point
+     * within a cell size of it. Points further away may be visited as well,
+     * so callers still have to check the distance
+     *
+     * @param point the point to search around
+     * @param visit the function to call with each point found
+     */
+    template <typename Function>
+    void forEachNear(const Point& point, Function visit) const {
+        long cell_x = getCell(point.x);
+        long cell_y = getCell(point.y);
+
+        // Neighbouring cells can hash into the same bucket, which should
+        // still only be visited once
+        size_t visited[9];
+        int num_visited = 0;
+        for (long dx = -1; dx <= 1; dx++) {
+            for (long dy = -1; dy <= 1; dy++) {
+                size_t bucket = getBucket(cell_x + dx, cell_y + dy);
+                if (std::find(visited, visited + num_visited, bucket) !=
+                    visited + num_visited) {
+                    continue;
+                }
+                visited[num_visited++] = bucket;
+
+                for (const Entry& entry : buckets[bucket]) {
+                    visit(entry.point, entry.value);
+                }
+            }
+        }
+    }
+
+  private:
+    struct Entry {
+        Point point;
+        size_t value;
+    };
+
+    inline long getCell(double coordinate) const {
+        return (long) std::floor(coordinate / cell_size);
+    }
+
+    /**
+     * @return the index of the bucket holding the grid cell (cell_x, cell_y)
+     */
+    size_t getBucket(long cell_x, long cell_y) const;
+
+    double cell_size;
+
+    // The points in each grid cell, with the cells hashed into a fixed number
+    // of buckets
+    std::vector<std::vector<Entry>> buckets;
+};
+
+#endif // DRAG_RACE_IARRC_SPATIALHASH_H
@@ -0,0 +1,136 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A map of the cones seen across scans, kept in the odometry
+ *              frame so it stays put while the robot moves. Cones are
+ *              refined with every scan they are seen in and forgotten after
+ *              going unseen for a while, and the cone lines are only refit
+ *              when the cones in the map change
+ */
+
+// STD Includes
+#include <cmath>
+
+// Snowbots Includes
+#include <ConeMap.h>
+
+ConeMap::ConeMap(double max_merging_distance,
+                 double cone_grouping_tolerance,
+                 unsigned int min_hits,
+                 unsigned int max_missed_scans)
+  : max_merging_distance(max_merging_distance),
+    cone_grouping_tolerance(cone_grouping_tolerance),
+    min_hits(min_hits),
+    max_missed_scans(max_missed_scans),
+    robot_x(0),
+    robot_y(0),
+    robot_yaw(0),
+    cone_centers(max_merging_distance) {}
+
+void ConeMap::update(const std::vector<Point>& scan_cones,
+                     double robot_x,
+                     double robot_y,
+                     double robot_yaw) {
+    this->robot_x   = robot_x;
+    this->robot_y   = robot_y;
+    this->robot_yaw = robot_yaw;
+
+    cone_centers.clear();
+    for (size_t i = 0; i < cones.size(); i++) {
+        cone_centers.insert(cones[i].center, i);
+    }
+    seen.assign(cones.size(), false);
+
+    // The cone lines only change when a cone starts or stops being used
+    // for them
+    bool cones_changed = false;
+
+    double cos_yaw = std::cos(robot_yaw);
+    double sin_yaw = std::sin(robot_yaw);
+    for (const Point& scan_cone : scan_cones) {
+        // Move the cone into the odometry frame
+        Point center{robot_x + cos_yaw * scan_cone.x - sin_yaw * scan_cone.y,
+                     robot_y + sin_yaw * scan_cone.x + cos_yaw * scan_cone.y};
+
+        // Find the closest mapped cone that hasn't been seen yet
+        size_t closest          = cones.size();
+        double closest_distance = max_merging_distance;
+        cone_centers.forEachNear(
+        center, [&](const Point& mapped_center, size_t i) {
+            double distance = distanceBetweenPoints(center, mapped_center);
+            if (!seen[i] && distance < closest_distance) {
+                closest          = i;
+                closest_distance = distance;
+            }
+        });
+
+        if (closest < cones.size()) {
+            // Average in the new sighting
+            MappedCone& cone = cones[closest];
+            cone.hits++;
+            cone.center.x += (center.x - cone.center.x) / cone.hits;
+            cone.center.y += (center.y - cone.center.y) / cone.hits;
+            cone.missed_scans = 0;
+            seen[closest]     = true;
+
+            // The cone has just been seen often enough to be used
+            if (cone.hits == min_hits) { cones_changed = true; }
+        } else {
+            cones.emplace_back(MappedCone{center, 1, 0});
+            seen.emplace_back(true);
+            if (min_hits <= 1) { cones_changed = true; }
+        }
+    }
+
+    // Forget the cones that have gone unseen for too long
+    size_t num_kept = 0;
+    for (size_t i = 0; i < cones.size(); i++) {
+        if (!seen[i] && ++cones[i].missed_scans > max_missed_scans) {
+            if (cones[i].hits >= min_hits) { cones_changed = true; }
+            continue;
+        }
+        cones[num_kept++] = cones[i];
+    }
+    cones.resize(num_kept);
+
+    if (cones_changed) refitConeLines();
+}
+
+std::vector<LineOfBestFit> ConeMap::getConeLines() const {
+    // Moving a point from the odometry frame into the robot's frame undoes
+    // the robot's translation, then its rotation
+    double cos_yaw = std::cos(robot_yaw);
+    double sin_yaw = std::sin(robot_yaw);
+    double dx      = -(cos_yaw * robot_x + sin_yaw * robot_y);
+    double dy      = -(-sin_yaw * robot_x + cos_yaw * robot_y);
+
+    std::vector<LineOfBestFit> lines;
+    for (LineStatsAccumulator stats : cone_line_stats) {
+        stats.transform(-robot_yaw, dx, dy);
+        lines.emplace_back(LidarObstacleManager::getLineOfBestFit(stats));
+    }
+
+    return lines;
+}
+
+void ConeMap::clear() {
+    cones.clear();
+    cone_line_stats.clear();
+}
+
+void ConeMap::refitConeLines() {
+    std::vector<Point> centers;
+    for (const MappedCone& cone : cones) {
+        if (cone.hits >= min_hits) centers.emplace_back(cone.center);
+    }
+
+    cone_line_stats.clear();
+    for (const std::vector<size_t>& group :
+         point_grouper.group(centers, cone_grouping_tolerance)) {
+        if (group.size() < 2) continue;
+
+        LineStatsAccumulator stats;
+        for (size_t i : group) stats.add(centers[i]);
+        cone_line_stats.emplace_back(stats);
+    }
+}
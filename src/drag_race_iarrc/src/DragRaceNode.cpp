@@ -9,7 +9,7 @@
 #include <DragRaceNode.h>
 
 DragRaceNode::DragRaceNode(int argc, char** argv, std::string node_name)
-  : green_count_recognised(0) {
+  : green_count_recognised(0), robot_x(0), robot_y(0), robot_yaw(0) {
     // Setup NodeHandles
     ros::init(argc, argv, node_name);
     ros::NodeHandle nh;
@@ -88,6 +88,16 @@ DragRaceNode::DragRaceNode(int argc, char** argv, std::string node_name)
     SB_getParam(
     private_nh, "region_fill_percentage", region_fill_percentage, 0.5);
 
+    // Cone map params
+    SB_getParam(private_nh, "use_cone_map", use_cone_map, false);
+    int cone_map_min_hits, cone_map_max_missed_scans;
+    SB_getParam(private_nh, "cone_map_min_hits", cone_map_min_hits, 2);
+    SB_getParam(
+    private_nh, "cone_map_max_missed_scans", cone_map_max_missed_scans, 10);
+    std::string odom_topic;
+    SB_getParam(
+    private_nh, "odom_topic", odom_topic, std::string("/encoders/odom"));
+
     // Setup drag race controller with given params
     drag_race_controller = DragRaceController(target_distance,
                                               line_to_the_right,
@@ -109,6 +119,16 @@ DragRaceNode::DragRaceNode(int argc, char** argv, std::string node_name)
                                             region_fill_percentage,
                                             front_collision_only);
 
+    // Setup the cone map with given params
+    cone_map = ConeMap(max_obstacle_merging_distance,
+                       cone_grouping_tolerance,
+                       cone_map_min_hits,
+                       cone_map_max_missed_scans);
+    if (use_cone_map) {
+        odom_subscriber =
+        nh.subscribe(odom_topic, queue_size, &DragRaceNode::odomCallBack, this);
+    }
+
     end_of_course           = false;
     incoming_obstacle_ticks = 0;
 }
@@ -118,13 +138,31 @@ const std_msgs::Bool& green_light_detected) {
     if (green_light_detected.data) { green_count_recognised++; }
 }
 
+void DragRaceNode::odomCallBack(const nav_msgs::Odometry::ConstPtr& odom) {
+    robot_x   = odom->pose.pose.position.x;
+    robot_y   = odom->pose.pose.position.y;
+    robot_yaw = tf::getYaw(odom->pose.pose.orientation);
+}
+
 void DragRaceNode::scanCallBack(const sensor_msgs::LaserScan::ConstPtr& scan) {
-    // Clear any obstacles we already have
+    // Clear any obstacles we already have (obstacles are made of the readings
+    // of a single scan, so can't be carried over to the next one)
     obstacle_manager.clearObstacles();
 
     // Insert the scan we just received
     obstacle_manager.addLaserScan(*scan);
 
+    // Get the lines of cones, either from the cones in the map or from the
+    // ones in this scan
+    std::vector<LineOfBestFit> cone_lines;
+    if (use_cone_map) {
+        cone_map.update(
+        obstacle_manager.getConeCenters(), robot_x, robot_y, robot_yaw);
+        cone_lines = cone_map.getConeLines();
+    } else {
+        cone_lines = obstacle_manager.getConeLines();
+    }
+
     bool no_line_on_expected_side = false;
 
     // TODO: Option 1
@@ -147,11 +185,13 @@ void DragRaceNode::scanCallBack(const sensor_msgs::LaserScan::ConstPtr& scan) {
     }
 
     // Get the best line for us
-    LineOfBestFit best_line = obstacle_manager.getBestLine(line_to_the_right);
+    LineOfBestFit best_line =
+    obstacle_manager.getBestLine(cone_lines, line_to_the_right);
 
     // If no good lines, initiate plan B and use lines on the other side.
     if (best_line.correlation == 0) {
-        best_line = obstacle_manager.getBestLine(!line_to_the_right);
+        best_line =
+        obstacle_manager.getBestLine(cone_lines, !line_to_the_right);
         no_line_on_expected_side = true;
     }
 
@@ -177,7 +217,7 @@ void DragRaceNode::scanCallBack(const sensor_msgs::LaserScan::ConstPtr& scan) {
     // Broadcast a visualisable representation so we can see obstacles in RViz
     cone_debug_publisher.publish(obstacle_manager.getConeRVizMarker());
     cone_line_debug_publisher.publish(
-    obstacle_manager.getConeLinesRVizMarker());
+    LidarObstacleManager::getConeLinesRVizMarker(cone_lines));
     best_line_debug_publisher.publish(
-    obstacle_manager.getBestConeLineRVizMarker(line_to_the_right));
+    obstacle_manager.getBestConeLineRVizMarker(cone_lines, line_to_the_right));
 }
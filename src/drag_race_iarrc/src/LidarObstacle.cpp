@@ -7,7 +7,6 @@
 
 // STD Includes
 #include <math.h>
-#include <numeric>
 
 // Snowbots Includes
 #include <LidarObstacle.h>
@@ -33,112 +32,109 @@ LidarObstacle::LidarObstacle(std::vector<Reading> readings)
 
 LidarObstacle::LidarObstacle(double min_wall_length,
                              std::vector<Reading> readings)
-  : min_wall_length(min_wall_length), obstacle_type(NONE) {
-    this->mergeInReadings(readings);
+  : point_sum{0, 0}, obstacle_type(NONE), min_wall_length(min_wall_length) {
+    for (const Reading& reading : readings) {
+        addReading(reading, pointFromReading(reading));
+    }
+    determineObstacleType();
+    updateCenter();
 }
 
-distance_t LidarObstacle::getAvgDistance() {
-    double total_distance = std::accumulate(
-    readings.begin(), readings.end(), 0, [](int accumulator, auto reading) {
-        return accumulator + reading.range;
-    });
-    return total_distance / readings.size();
+LidarObstacle::LidarObstacle(double min_wall_length,
+                             const Reading& reading,
+                             const Point& point)
+  : point_sum{0, 0}, obstacle_type(NONE), min_wall_length(min_wall_length) {
+    addReading(reading, point);
+    determineObstacleType();
+    updateCenter();
+}
+
+distance_t LidarObstacle::getAvgDistance() const {
+    return readings.getAvgRange();
 }
 
-angle_t LidarObstacle::getAvgAngle() {
-    double total_angle = std::accumulate(readings.begin(),
-                                         readings.end(),
-                                         0.0,
-                                         [](double accumulator, auto reading) {
-                                             return accumulator + reading.angle;
-                                         });
-    return total_angle / readings.size();
+angle_t LidarObstacle::getAvgAngle() const {
+    return readings.getAvgAngle();
 }
 
-angle_t LidarObstacle::getMinAngle() {
+angle_t LidarObstacle::getMinAngle() const {
     // Readings are sorted, so min angle is just the first Reading
-    return readings[0].angle;
+    return readings.getMinAngle();
 }
 
-angle_t LidarObstacle::getMaxAngle() {
+angle_t LidarObstacle::getMaxAngle() const {
     // Readings are sorted, so max angle is just the last Reading
-    return readings[readings.size() - 1].angle;
+    return readings.getMaxAngle();
 }
 
-distance_t LidarObstacle::getLastDistance() {
-    return readings[readings.size() - 1].range;
+distance_t LidarObstacle::getLastDistance() const {
+    return readings.getLastRange();
 }
 
-distance_t LidarObstacle::getFirstDistance() {
-    return readings[0].range;
+distance_t LidarObstacle::getFirstDistance() const {
+    return readings.getFirstRange();
 }
 
-const std::vector<Reading>& LidarObstacle::getAllLaserReadings() {
-    return readings;
-};
-
-distance_t LidarObstacle::getMinDistance() {
-    std::vector<Reading> readings = getAllLaserReadings();
-    Reading reading_with_min_distance =
-    *std::min_element(readings.begin(),
-                      readings.end(),
-                      [&](auto const& reading1, auto const& reading2) {
-                          return reading1.range < reading2.range;
-                      });
-    return reading_with_min_distance.range;
+std::vector<Reading> LidarObstacle::getAllLaserReadings() const {
+    std::vector<Reading> all_readings;
+    all_readings.reserve(readings.size());
+    for (size_t i = 0; i < readings.size(); i++) {
+        all_readings.emplace_back(
+        Reading{readings.getAngles()[i], readings.getRanges()[i]});
+    }
+    return all_readings;
 }
 
-distance_t LidarObstacle::getMaxDistance() {
-    std::vector<Reading> readings = getAllLaserReadings();
-    Reading reading_with_max_distance =
-    *std::max_element(readings.begin(),
-                      readings.end(),
-                      [&](auto const& reading1, auto const& reading2) {
-                          return reading1.range > reading2.range;
-                      });
-    return reading_with_max_distance.range;
+distance_t LidarObstacle::getMinDistance() const {
+    return readings.getMinRange();
 }
 
-void LidarObstacle::mergeInLidarObstacle(LidarObstacle& obstacle) {
-    // Get readings from obstacle being merged in
-    std::vector<Reading> new_readings = obstacle.getAllLaserReadings();
-    this->mergeInReadings(new_readings);
+distance_t LidarObstacle::getMaxDistance() const {
+    return readings.getMaxRange();
 }
 
-void LidarObstacle::mergeInReadings(std::vector<Reading>& new_readings) {
-    this->readings.insert(
-    readings.end(), new_readings.begin(), new_readings.end());
-    // Ensure that the readings are still sorted
-    std::sort(readings.begin(),
-              readings.end(),
-              [&](auto const& reading1, auto const& reading2) {
-                  return reading1.angle < reading2.angle;
-              });
+void LidarObstacle::mergeInLidarObstacle(const LidarObstacle& obstacle) {
+    // Readings from a scan usually come in one at a time, in order of angle,
+    // in which case the points can just be appended too
+    std::vector<size_t> order;
+    if (readings.merge(obstacle.readings, order)) {
+        points.insert(
+        points.end(), obstacle.points.begin(), obstacle.points.end());
+    } else {
+        // Keep each point with its reading
+        std::vector<Point> merged_points;
+        merged_points.reserve(order.size());
+        for (size_t i : order) {
+            merged_points.emplace_back(
+            i < points.size() ? points[i] : obstacle.points[i - points.size()]);
+        }
+        points = std::move(merged_points);
+    }
+    point_sum.x += obstacle.point_sum.x;
+    point_sum.y += obstacle.point_sum.y;
+
     // Ensure the obstacle type is still correct
     determineObstacleType();
     // Update the center of the obstacle
     updateCenter();
 }
 
-void LidarObstacle::updateCenter() {
-    // Create points for all readings
-    std::vector<Point> points = getReadingsAsPoints();
+void LidarObstacle::addReading(const Reading& reading, const Point& point) {
+    size_t index = readings.add(reading.angle, reading.range);
+    points.insert(points.begin() + index, point);
+    point_sum.x += point.x;
+    point_sum.y += point.y;
+}
 
+void LidarObstacle::updateCenter() {
     // Average Points to get new center
-    Point averaged_point{0, 0};
-    for (Point p : points) {
-        averaged_point.x += p.x;
-        averaged_point.y += p.y;
-    }
-    averaged_point.x /= points.size();
-    averaged_point.y /= points.size();
-    center = averaged_point;
+    center = Point{point_sum.x / points.size(), point_sum.y / points.size()};
 }
 
 void LidarObstacle::determineObstacleType() {
     // TODO: Setup some sort of min number of readings to be considered a cone
     // If this obstacle has no readings, then it's NONE
-    if (readings.size() == 0) obstacle_type = NONE;
+    if (readings.empty()) obstacle_type = NONE;
     // If the obstacle is long enough, then it's a WALL
     else if (getLength() > min_wall_length)
         obstacle_type = WALL;
@@ -148,34 +144,29 @@ void LidarObstacle::determineObstacleType() {
 
 // TODO: Is there a more appropriate place for these functions?
 
-double LidarObstacle::getLength() {
+double LidarObstacle::getLength() const {
     // Using Law of Cosines (c^2 = a^2 + b^2 + 2ab*Cos(C)) to get the length
     // from the leftmost to the rightmost point
-    double left_length  = readings[0].range;
-    double right_length = readings.back().range;
-    double theta        = std::abs(readings[0].angle - readings.back().angle);
+    double left_length  = readings.getFirstRange();
+    double right_length = readings.getLastRange();
+    double theta = std::abs(readings.getMinAngle() - readings.getMaxAngle());
     return std::sqrt(std::pow(left_length, 2) + std::pow(right_length, 2) -
                      2 * left_length * right_length * std::cos(theta));
 }
 
-double LidarObstacle::getMinWallLength() {
+double LidarObstacle::getMinWallLength() const {
     return min_wall_length;
 }
 
-ObstacleType LidarObstacle::getObstacleType() {
+ObstacleType LidarObstacle::getObstacleType() const {
     return obstacle_type;
 }
 
-Point LidarObstacle::getCenter() {
+Point LidarObstacle::getCenter() const {
     return center;
 }
 
-std::vector<Point> LidarObstacle::getReadingsAsPoints() {
-    std::vector<Point> points;
-    for (Reading reading : readings) {
-        Point p = pointFromReading(reading);
-        points.emplace_back(p);
-    }
+const std::vector<Point>& LidarObstacle::getReadingsAsPoints() const {
     return points;
 }
 
@@ -6,15 +6,16 @@
 
 // STD Includes
 #include <cmath>
-#include <numeric>
-#include <stack>
 
 // Snowbots Includes
 #include <LidarObstacleManager.h>
 
 // TODO: We should probably get rid of the default constructor here.....
 LidarObstacleManager::LidarObstacleManager()
-  : max_obstacle_merging_distance(0.3), cone_grouping_tolerance(1.3){};
+  : max_obstacle_merging_distance(0.3),
+    obstacle_points(0.3),
+    last_obstacle(0),
+    cone_grouping_tolerance(1.3){};
 
 LidarObstacleManager::LidarObstacleManager(
 double max_obstacle_merging_distance,
@@ -29,6 +30,8 @@ double side_angle_min,
 double region_fill_percentage,
 bool front_collision_only)
   : max_obstacle_merging_distance(max_obstacle_merging_distance),
+    obstacle_points(max_obstacle_merging_distance),
+    last_obstacle(0),
     max_distance_from_robot_accepted(max_distance_from_robot_accepted),
     cone_grouping_tolerance(cone_grouping_tolerance),
     min_wall_length(min_wall_length),
@@ -45,13 +48,17 @@ void LidarObstacleManager::addLaserScan(const sensor_msgs::LaserScan& scan) {
     int right_side_hits = 0;
     int front_side_hits = 0;
 
+    projector.project(scan, scan_x, scan_y);
+
     // Create an obstacle for every hit in the lidar scan
     for (int i = 0; i < scan.ranges.size(); ++i) {
         // Check that the lidar hit is within acceptable bounds
         double angle = scan.angle_min + i * scan.angle_increment;
         double range = scan.ranges[i];
         if (range < scan.range_max && range > scan.range_min) {
-            addObstacle(LidarObstacle(min_wall_length, angle, range));
+            addObstacle(LidarObstacle(min_wall_length,
+                                      Reading{angle, range},
+                                      Point{scan_x[i], scan_y[i]}));
 
             double abs_angle = std::abs(angle);
             if (abs_angle < side_angle_max && abs_angle > side_angle_min) {
@@ -85,31 +92,73 @@ void LidarObstacleManager::addLaserScan(const sensor_msgs::LaserScan& scan) {
     }
 }
 
-std::vector<LidarObstacle> LidarObstacleManager::getObstacles() {
+const std::vector<LidarObstacle>& LidarObstacleManager::getObstacles() const {
     return obstacles;
 }
 
 void LidarObstacleManager::clearObstacles() {
     obstacles.clear();
+    obstacle_points.clear();
+}
+
+static inline double squaredDistanceBetweenPoints(const Point& p1,
+                                                  const Point& p2) {
+    return (p1.x - p2.x) * (p1.x - p2.x) + (p1.y - p2.y) * (p1.y - p2.y);
 }
 
 void LidarObstacleManager::addObstacle(LidarObstacle obstacle) {
+    const std::vector<Point>& points = obstacle.getReadingsAsPoints();
+    // An obstacle without readings has nothing to merge in
+    if (points.empty()) return;
+
     // See if this obstacle is close enough to any other saved obstacle to be
-    // the same
+    // the same, taking the first one that is
     // TODO: Should we be instead checking for the CLOSEST saved obstcle?
-    for (LidarObstacle& saved_obstacle : obstacles) {
-        if (minDistanceBetweenObstacles(saved_obstacle, obstacle) <
-            max_obstacle_merging_distance) {
-            saved_obstacle.mergeInLidarObstacle(obstacle);
-            return;
+    double max_distance_squared =
+    max_obstacle_merging_distance * max_obstacle_merging_distance;
+    size_t merge_index = obstacles.size();
+
+    // Consecutive beams of a scan usually hit the same obstacle, so check the
+    // obstacle the last one went into first. If it's close, only obstacles
+    // saved before it can still be the first close one
+    if (last_obstacle < obstacles.size()) {
+        for (const Point& point : points) {
+            if (squaredDistanceBetweenPoints(point, last_point) <
+                max_distance_squared) {
+                merge_index = last_obstacle;
+                break;
+            }
         }
     }
-    obstacles.emplace_back(obstacle);
+
+    // Any saved point close enough to merge with is in the grid cells around
+    // one of our points
+    for (const Point& point : points) {
+        obstacle_points.forEachNear(
+        point, [&](const Point& saved_point, size_t index) {
+            if (index < merge_index &&
+                squaredDistanceBetweenPoints(point, saved_point) <
+                max_distance_squared) {
+                merge_index = index;
+            }
+        });
+    }
+
+    for (const Point& point : points) {
+        obstacle_points.insert(point, merge_index);
+    }
+    last_obstacle = merge_index;
+    last_point    = points.back();
+
+    if (merge_index < obstacles.size()) {
+        obstacles[merge_index].mergeInLidarObstacle(obstacle);
+    } else {
+        obstacles.emplace_back(std::move(obstacle));
+    }
 }
 
-double
-LidarObstacleManager::minDistanceBetweenObstacles(LidarObstacle obstacle1,
-                                                  LidarObstacle obstacle2) {
+double LidarObstacleManager::minDistanceBetweenObstacles(
+const LidarObstacle& obstacle1, const LidarObstacle& obstacle2) {
     // TODO: This is ABSURDLY ineffecient. We're doing n^2 operations on 2
     // potentially
     // TODO: very large objects. We should be able to do some sort of obstacle
@@ -117,13 +166,15 @@ LidarObstacleManager::minDistanceBetweenObstacles(LidarObstacle obstacle1,
     // TODO: circles or boxes and compare them that way (need to update
     // LidarObstacle for that approx)
 
-    std::vector<Point> obstacle1_points = obstacle1.getReadingsAsPoints();
-    std::vector<Point> obstacle2_points = obstacle2.getReadingsAsPoints();
+    const std::vector<Point>& obstacle1_points =
+    obstacle1.getReadingsAsPoints();
+    const std::vector<Point>& obstacle2_points =
+    obstacle2.getReadingsAsPoints();
 
     // Compare every point to.... *shudders slightly* every other point..
     double min_distance = -1;
-    for (Point p1 : obstacle1_points) {
-        for (Point p2 : obstacle2_points) {
+    for (const Point& p1 : obstacle1_points) {
+        for (const Point& p2 : obstacle2_points) {
             double dx       = p1.x - p2.x;
             double dy       = p1.y - p2.y;
             double distance = std::sqrt(std::pow(dx, 2.0) + std::pow(dy, 2.0));
@@ -135,133 +186,85 @@ LidarObstacleManager::minDistanceBetweenObstacles(LidarObstacle obstacle1,
     return min_distance;
 }
 
-std::vector<LineOfBestFit> LidarObstacleManager::getConeLines() {
-    // Get all our cones as points
-    std::vector<Point> points;
-    for (LidarObstacle obstacle : obstacles) {
+std::vector<Point> LidarObstacleManager::getConeCenters() {
+    std::vector<Point> centers;
+    for (const LidarObstacle& obstacle : obstacles) {
         if (obstacle.getObstacleType() == CONE) {
-            points.emplace_back(obstacle.getCenter());
+            centers.emplace_back(obstacle.getCenter());
         }
     }
+    return centers;
+}
+
+std::vector<LineOfBestFit> LidarObstacleManager::getConeLines() {
+    // Get all our cones as points
+    std::vector<Point> points = getConeCenters();
 
     // Get groups of lines
-    std::vector<std::vector<Point>> groups =
-    getPointGroupings(points, cone_grouping_tolerance);
+    std::vector<std::vector<size_t>> groups =
+    getPointGroupIndices(points, cone_grouping_tolerance);
 
     // Fit a line of best fit to each group
     std::vector<LineOfBestFit> lines;
-    for (std::vector<Point> group : groups)
-        if (group.size() >= 2) lines.emplace_back(getLineOfBestFit(group));
+    for (const std::vector<size_t>& group : groups) {
+        if (group.size() < 2) continue;
+
+        LineStatsAccumulator stats;
+        for (size_t i : group) stats.add(points[i]);
+        lines.emplace_back(getLineOfBestFit(stats));
+    }
 
     return lines;
 }
 
 std::vector<std::vector<Point>>
-LidarObstacleManager::getPointGroupings(std::vector<Point> points,
+LidarObstacleManager::getPointGroupings(const std::vector<Point>& points,
                                         double tolerance) {
     std::vector<std::vector<Point>> groups;
-
-    // Go through every point
-    while (points.size() > 0) {
-        // Start the current group off with the last point
+    for (const std::vector<size_t>& group_indices :
+         getPointGroupIndices(points, tolerance)) {
         std::vector<Point> group;
-        std::stack<Point> to_visit;
-        to_visit.emplace(points.back());
-        points.pop_back();
-        while (to_visit.size() > 0) {
-            // Visit the first point in to_visit
-            Point curr_point = to_visit.top();
-            to_visit.pop();
-
-            // Figure out if there are any points within tolerance of the point
-            // we're visiting
-            for (int i = 0; i < points.size(); i++) {
-                Point p = points[i];
-                if (distanceBetweenPoints(curr_point, p) < tolerance) {
-                    // Add point to to_visit and remove from the given list of
-                    // points
-                    to_visit.emplace(p);
-                    points.erase(points.begin() + i);
-                }
-            }
-
-            // Add the current point to the group
-            group.emplace_back(curr_point);
-
-            // Keep going if we've got more points to visit
-        }
-
+        for (size_t i : group_indices) group.emplace_back(points[i]);
         groups.emplace_back(group);
     }
 
     return groups;
 }
 
+std::vector<std::vector<size_t>>
+LidarObstacleManager::getPointGroupIndices(const std::vector<Point>& points,
+                                           double tolerance) {
+    return point_grouper.group(points, tolerance);
+}
+
 LineOfBestFit
 LidarObstacleManager::getLineOfBestFit(const std::vector<Point>& points) {
+    LineStatsAccumulator stats;
+    for (const Point& p : points) stats.add(p);
+    return getLineOfBestFit(stats);
+}
+
+LineOfBestFit
+LidarObstacleManager::getLineOfBestFit(const LineStatsAccumulator& stats) {
     // Get line of best fit using linear regression formula
     // http://www.statisticshowto.com/how-to-find-a-linear-regression-equation/
 
     // TODO: Handle this more nicely
     // WE SHOULD NEVER GET HERE
-    BOOST_ASSERT(points.size() >= 2);
-
-    double x_sum = std::accumulate(
-    points.begin(), points.end(), 0.0, [](double accum, Point p) {
-        return accum + p.x;
-    });
-    double y_sum = std::accumulate(
-    points.begin(), points.end(), 0.0, [](double accum, Point p) {
-        return accum + p.y;
-    });
-    double x_squared_sum = std::accumulate(
-    points.begin(), points.end(), 0.0, [](double accum, Point p) {
-        return accum + std::pow(p.x, 2.0);
-    });
-    double x_y_product_sum = std::accumulate(
-    points.begin(), points.end(), 0.0, [](double accum, Point p) {
-        return accum + p.x * p.y;
-    });
-    double y_intercept = (y_sum * x_squared_sum - x_sum * x_y_product_sum) /
-                         (points.size() * x_squared_sum - std::pow(x_sum, 2.0));
-    double slope = (points.size() * x_y_product_sum - x_sum * y_sum) /
-                   (points.size() * x_squared_sum - std::pow(x_sum, 2.0));
-
-    // Calculate means
-    double x_mean = x_sum / points.size();
-    double y_mean = y_sum / points.size();
-
-    // Calculate Variances
-    double x_var =
-    std::accumulate(points.begin(),
-                    points.end(),
-                    0.0,
-                    [x_mean](double accum, Point p) {
-                        return accum + std::pow((x_mean - p.x), 2.0);
-                    }) /
-    (points.size() - 1);
-    double y_var =
-    std::accumulate(points.begin(),
-                    points.end(),
-                    0.0,
-                    [y_mean](double accum, Point p) {
-                        return accum + std::pow((y_mean - p.y), 2.0);
-                    }) /
-    (points.size() - 1);
-    // Calculate standard deviations
-    double x_sd = sqrt(x_var);
-    double y_sd = sqrt(y_var);
-
-    // Calculate correlation coefficient using Slope = r*Sy/Sx
-    double r = slope * x_sd / y_sd;
-
-    return LineOfBestFit(slope, y_intercept, r);
+    BOOST_ASSERT(stats.count() >= 2);
+
+    return LineOfBestFit(
+    stats.getSlope(), stats.getYIntercept(), stats.getCorrelation());
 }
 
 LineOfBestFit LidarObstacleManager::getBestLine(bool lineToTheRight) {
-    LineOfBestFit bestLine(0, 0, 0);
+    return getBestLine(getConeLines(), lineToTheRight);
+}
 
-    std::vector<LineOfBestFit> lines = getConeLines();
+LineOfBestFit
+LidarObstacleManager::getBestLine(const std::vector<LineOfBestFit>& lines,
+                                  bool lineToTheRight) {
+    LineOfBestFit bestLine(0, 0, 0);
 
     for (size_t i = 0; i < lines.size(); i++) {
         // Only check lines where the y-intercept is on the correct side.
@@ -302,7 +305,7 @@ visualization_msgs::Marker LidarObstacleManager::getConeRVizMarker() {
     points.color.g = 1.0f;
     points.color.a = 1.0;
 
-    for (LidarObstacle obstacle : obstacles) {
+    for (const LidarObstacle& obstacle : obstacles) {
         if (obstacle.getObstacleType() == CONE) {
             Point center = obstacle.getCenter();
             geometry_msgs::Point geom_point;
@@ -316,6 +319,11 @@ visualization_msgs::Marker LidarObstacleManager::getConeRVizMarker() {
 }
 
 visualization_msgs::Marker LidarObstacleManager::getConeLinesRVizMarker() {
+    return getConeLinesRVizMarker(getConeLines());
+}
+
+visualization_msgs::Marker LidarObstacleManager::getConeLinesRVizMarker(
+const std::vector<LineOfBestFit>& cone_lines) {
     visualization_msgs::Marker lines;
 
     // TODO: Should be a param (currently in the default LaserScan frame)
@@ -334,8 +342,6 @@ visualization_msgs::Marker LidarObstacleManager::getConeLinesRVizMarker() {
     lines.color.r = 1.0f;
     lines.color.a = 1.0;
 
-    // Get the cone lines
-    std::vector<LineOfBestFit> cone_lines = getConeLines();
     for (int i = 0; i < cone_lines.size(); i++) {
         // Get two points to represent the line
         geometry_msgs::Point p1, p2;
@@ -353,6 +359,11 @@ visualization_msgs::Marker LidarObstacleManager::getConeLinesRVizMarker() {
 // TODO: See comments in above visualisation functions
 visualization_msgs::Marker
 LidarObstacleManager::getBestConeLineRVizMarker(bool line_to_the_right) {
+    return getBestConeLineRVizMarker(getConeLines(), line_to_the_right);
+}
+
+visualization_msgs::Marker LidarObstacleManager::getBestConeLineRVizMarker(
+const std::vector<LineOfBestFit>& cone_lines, bool line_to_the_right) {
     // We'll just put a single line in this
     visualization_msgs::Marker line;
 
@@ -373,9 +384,10 @@ LidarObstacleManager::getBestConeLineRVizMarker(bool line_to_the_right) {
     line.color.a = 1.0;
 
     // TODO: Find a better way to sync this logic up. Copy pasting sucks
-    LineOfBestFit best_line = getBestLine(line_to_the_right);
+    LineOfBestFit best_line = getBestLine(cone_lines, line_to_the_right);
     // If no line found on desired side
-    if (best_line.correlation == 0) best_line = getBestLine(!line_to_the_right);
+    if (best_line.correlation == 0)
+        best_line = getBestLine(cone_lines, !line_to_the_right);
     geometry_msgs::Point p1, p2;
     p1.x = -10;
     p1.y = best_line.getYCoorAtX(p1.x);
@@ -0,0 +1,96 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Accumulates the statistics needed for a line of best fit
+ *              through a set of points in a single pass, using Welford's
+ *              method so the result stays accurate for points far from the
+ *              origin
+ */
+
+// STD Includes
+#include <cmath>
+
+// Snowbots Includes
+#include <LineStatsAccumulator.h>
+
+LineStatsAccumulator::LineStatsAccumulator() {
+    clear();
+}
+
+void LineStatsAccumulator::add(const Point& point) {
+    num_points++;
+
+    // Welford's update: the old mean's difference times the new mean's
+    // difference adds exactly this point's share of the sums
+    double dx = point.x - mean_x;
+    double dy = point.y - mean_y;
+    mean_x += dx / num_points;
+    mean_y += dy / num_points;
+    x_deviation_squared_sum += dx * (point.x - mean_x);
+    y_deviation_squared_sum += dy * (point.y - mean_y);
+    xy_deviation_product_sum += dx * (point.y - mean_y);
+}
+
+void LineStatsAccumulator::merge(const LineStatsAccumulator& other) {
+    if (other.num_points == 0) return;
+    if (num_points == 0) {
+        *this = other;
+        return;
+    }
+
+    // Chan et al.'s pairwise combination of the two sets of sums
+    double total  = num_points + other.num_points;
+    double dx     = other.mean_x - mean_x;
+    double dy     = other.mean_y - mean_y;
+    double weight = num_points * other.num_points / total;
+
+    mean_x += dx * other.num_points / total;
+    mean_y += dy * other.num_points / total;
+    x_deviation_squared_sum += other.x_deviation_squared_sum + dx * dx * weight;
+    y_deviation_squared_sum += other.y_deviation_squared_sum + dy * dy * weight;
+    xy_deviation_product_sum +=
+    other.xy_deviation_product_sum + dx * dy * weight;
+    num_points += other.num_points;
+}
+
+void LineStatsAccumulator::clear() {
+    num_points               = 0;
+    mean_x                   = 0;
+    mean_y                   = 0;
+    x_deviation_squared_sum  = 0;
+    y_deviation_squared_sum  = 0;
+    xy_deviation_product_sum = 0;
+}
+
+void LineStatsAccumulator::transform(double angle, double dx, double dy) {
+    double c = std::cos(angle);
+    double s = std::sin(angle);
+
+    double new_mean_x = c * mean_x - s * mean_y + dx;
+    double new_mean_y = s * mean_x + c * mean_y + dy;
+    mean_x            = new_mean_x;
+    mean_y            = new_mean_y;
+
+    // Translating leaves the deviations from the mean alone, and rotating
+    // them rotates the second moments
+    double xx                = x_deviation_squared_sum;
+    double yy                = y_deviation_squared_sum;
+    double xy                = xy_deviation_product_sum;
+    x_deviation_squared_sum  = c * c * xx - 2 * c * s * xy + s * s * yy;
+    y_deviation_squared_sum  = s * s * xx + 2 * c * s * xy + c * c * yy;
+    xy_deviation_product_sum = c * s * (xx - yy) + (c * c - s * s) * xy;
+}
+
+double LineStatsAccumulator::getSlope() const {
+    return xy_deviation_product_sum / x_deviation_squared_sum;
+}
+
+double LineStatsAccumulator::getYIntercept() const {
+    return mean_y - getSlope() * mean_x;
+}
+
+double LineStatsAccumulator::getCorrelation() const {
+    // Slope = r * Sy / Sx
+    return getSlope() *
+           std::sqrt(x_deviation_squared_sum / y_deviation_squared_sum);
+}
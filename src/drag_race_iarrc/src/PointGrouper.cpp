@@ -0,0 +1,68 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Groups points that are connected by points closer than a
+ *              tolerance, using a spatial hash and a union-find
+ */
+
+// STD Includes
+#include <algorithm>
+#include <numeric>
+
+// Snowbots Includes
+#include <PointGrouper.h>
+
+// The hash's cell size is reset to the tolerance on every call
+PointGrouper::PointGrouper() : hash(1) {}
+
+// Finds the root of the union-find tree holding i, pointing every other node
+// on the way at its grandparent so later searches are shorter
+static size_t findGroupRoot(std::vector<size_t>& parents, size_t i) {
+    while (parents[i] != i) {
+        parents[i] = parents[parents[i]];
+        i          = parents[i];
+    }
+    return i;
+}
+
+std::vector<std::vector<size_t>>
+PointGrouper::group(const std::vector<Point>& points, double tolerance) {
+    // Every point starts off in its own group
+    parents.resize(points.size());
+    std::iota(parents.begin(), parents.end(), 0);
+
+    // Join the group of each point with the groups of all the points before
+    // it that are within tolerance. Those are all in the grid cells around
+    // it. (Nothing is within a tolerance of 0 or less)
+    if (tolerance > 0) {
+        hash.setCellSize(tolerance);
+        for (size_t i = 0; i < points.size(); i++) {
+            hash.forEachNear(points[i], [&](const Point& p, size_t j) {
+                if (distanceBetweenPoints(points[i], p) < tolerance) {
+                    // The lower index becomes the root, so each group's root
+                    // is its first point
+                    size_t root_i = findGroupRoot(parents, i);
+                    size_t root_j = findGroupRoot(parents, j);
+                    parents[std::max(root_i, root_j)] =
+                    std::min(root_i, root_j);
+                }
+            });
+            hash.insert(points[i], i);
+        }
+    }
+
+    // Each root is its group's first point, so groups are created in order
+    // of their first index
+    std::vector<std::vector<size_t>> groups;
+    std::vector<size_t> group_of_root(points.size());
+    for (size_t i = 0; i < points.size(); i++) {
+        size_t root = findGroupRoot(parents, i);
+        if (root == i) {
+            group_of_root[i] = groups.size();
+            groups.emplace_back();
+        }
+        groups[group_of_root[root]].emplace_back(i);
+    }
+
+    return groups;
+}
@@ -0,0 +1,35 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A spatial hash of points, for finding every point near a
+ *              given one without comparing it to all of them
+ */
+
+// Snowbots Includes
+#include <SpatialHash.h>
+
+// Must be a power of two, so a hash can be turned into a bucket with a mask.
+// Big enough that a scan's worth of grid cells rarely share a bucket
+static const size_t NUM_BUCKETS = 1024;
+
+SpatialHash::SpatialHash(double cell_size)
+  : cell_size(cell_size), buckets(NUM_BUCKETS) {}
+
+void SpatialHash::clear() {
+    for (std::vector<Entry>& bucket : buckets) { bucket.clear(); }
+}
+
+void SpatialHash::setCellSize(double cell_size) {
+    this->cell_size = cell_size;
+    clear();
+}
+
+void SpatialHash::insert(const Point& point, size_t value) {
+    buckets[getBucket(getCell(point.x), getCell(point.y))].push_back(
+    Entry{point, value});
+}
+
+size_t SpatialHash::getBucket(long cell_x, long cell_y) const {
+    size_t hash = (size_t) cell_x * 73856093 ^ (size_t) cell_y * 19349663;
+    return hash & (NUM_BUCKETS - 1);
+}
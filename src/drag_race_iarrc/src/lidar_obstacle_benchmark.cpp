@@ -0,0 +1,55 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Replays recorded LaserScans through the LidarObstacleManager,
+ *              as the drag race node does for every scan, and prints the
+ *              latency of each scan as a histogram. Parameters are the ones in
+ *              drag_race.launch
+ *
+ * Usage: rosrun drag_race_iarrc lidar_obstacle_benchmark
+ *            <scans.bag|scans.dump> [repeats] [topic]
+ */
+
+#include <LaserScanReplay.h>
+#include <LidarObstacleManager.h>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace snowbots;
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr,
+                "Usage: %s <scans.bag|scans.dump> [repeats] [topic]\n",
+                argv[0]);
+        return 1;
+    }
+
+    unsigned int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    std::string topic    = argc > 3 ? argv[3] : "";
+
+    std::vector<sensor_msgs::LaserScan> scans;
+    if (!loadLaserScans(argv[1], topic, scans) || scans.empty()) {
+        fprintf(stderr, "Could not load any scans from %s\n", argv[1]);
+        return 1;
+    }
+
+    LidarObstacleManager obstacle_manager(
+    0.3, 1.8, 2, 0.4, 3.0, 3.1415, 1.57, 1.30, 0.5, true);
+
+    size_t total_obstacles     = 0;
+    LatencyHistogram histogram = timeScans(
+    "addLaserScan", scans, repeats, [&](const sensor_msgs::LaserScan& scan) {
+        obstacle_manager.clearObstacles();
+        obstacle_manager.addLaserScan(scan);
+        total_obstacles += obstacle_manager.getObstacles().size();
+    });
+
+    printf("%zu scans of %zu beams, %.2f obstacles per scan\n\n",
+           scans.size(),
+           scans[0].ranges.size(),
+           (double) total_obstacles / ((repeats + 1) * scans.size()));
+    histogram.print();
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for ConeMap
+ */
+
+#include <ConeMap.h>
+#include <cmath>
+#include <gtest/gtest.h>
+
+class ConeMapTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        // A line of cones 1m to the right of the robot, seen from the origin
+        for (int i = 0; i < 4; i++) { scan_cones.push_back({1.0 + i, -1}); }
+    }
+
+    std::vector<Point> scan_cones;
+};
+
+TEST_F(ConeMapTest, conesNeedEnoughHitsForLines) {
+    ConeMap cone_map(0.3, 1.8, 2, 10);
+
+    cone_map.update(scan_cones, 0, 0, 0);
+    EXPECT_EQ(4, cone_map.getCones().size());
+    EXPECT_TRUE(cone_map.getConeLines().empty());
+
+    cone_map.update(scan_cones, 0, 0, 0);
+    EXPECT_EQ(4, cone_map.getCones().size());
+    std::vector<LineOfBestFit> lines = cone_map.getConeLines();
+    ASSERT_EQ(1, lines.size());
+    EXPECT_NEAR(0, lines[0].getSlope(), 1e-9);
+    EXPECT_NEAR(-1, lines[0].getYIntercept(), 1e-9);
+}
+
+TEST_F(ConeMapTest, conesStayPutWhileTheRobotMoves) {
+    ConeMap cone_map(0.3, 1.8, 2, 10);
+    cone_map.update(scan_cones, 0, 0, 0);
+
+    // Drive forward 0.5m while turning left, and see the same cones from there
+    double robot_x = 0.5, robot_y = 0.1, robot_yaw = 0.2;
+    std::vector<Point> moved_scan_cones;
+    for (const Point& cone : scan_cones) {
+        double dx = cone.x - robot_x, dy = cone.y - robot_y;
+        moved_scan_cones.push_back(
+        {std::cos(robot_yaw) * dx + std::sin(robot_yaw) * dy,
+         -std::sin(robot_yaw) * dx + std::cos(robot_yaw) * dy});
+    }
+    cone_map.update(moved_scan_cones, robot_x, robot_y, robot_yaw);
+
+    ASSERT_EQ(4, cone_map.getCones().size());
+    for (int i = 0; i < scan_cones.size(); i++) {
+        EXPECT_EQ(2, cone_map.getCones()[i].hits);
+        EXPECT_NEAR(scan_cones[i].x, cone_map.getCones()[i].center.x, 1e-9);
+        EXPECT_NEAR(scan_cones[i].y, cone_map.getCones()[i].center.y, 1e-9);
+    }
+
+    // The line is given relative to where the robot is now
+    std::vector<LineOfBestFit> lines = cone_map.getConeLines();
+    LineOfBestFit expected =
+    LidarObstacleManager::getLineOfBestFit(moved_scan_cones);
+    ASSERT_EQ(1, lines.size());
+    EXPECT_NEAR(expected.getSlope(), lines[0].getSlope(), 1e-9);
+    EXPECT_NEAR(expected.getYIntercept(), lines[0].getYIntercept(), 1e-9);
+    EXPECT_NEAR(expected.correlation, lines[0].correlation, 1e-9);
+}
+
+TEST_F(ConeMapTest, unseenConesAreForgotten) {
+    ConeMap cone_map(0.3, 1.8, 2, 2);
+    cone_map.update(scan_cones, 0, 0, 0);
+    cone_map.update(scan_cones, 0, 0, 0);
+    ASSERT_EQ(1, cone_map.getConeLines().size());
+
+    // Only see the first cone from now on
+    std::vector<Point> one_cone = {scan_cones[0]};
+    cone_map.update(one_cone, 0, 0, 0);
+    cone_map.update(one_cone, 0, 0, 0);
+    EXPECT_EQ(4, cone_map.getCones().size());
+    EXPECT_EQ(1, cone_map.getConeLines().size());
+
+    cone_map.update(one_cone, 0, 0, 0);
+    ASSERT_EQ(1, cone_map.getCones().size());
+    EXPECT_EQ(5, cone_map.getCones()[0].hits);
+    EXPECT_TRUE(cone_map.getConeLines().empty());
+}
+
+TEST_F(ConeMapTest, clearForgetsEverything) {
+    ConeMap cone_map(0.3, 1.8, 1, 10);
+    cone_map.update(scan_cones, 0, 0, 0);
+    ASSERT_EQ(1, cone_map.getConeLines().size());
+
+    cone_map.clear();
+    EXPECT_TRUE(cone_map.getCones().empty());
+    EXPECT_TRUE(cone_map.getConeLines().empty());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
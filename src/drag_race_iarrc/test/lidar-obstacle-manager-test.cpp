@@ -124,6 +124,82 @@ TEST_F(LidarObstacleManagerTest, addDuplicateObstacleTest) {
     EXPECT_EQ(1, obstacle_manager_1.getObstacles().size());
 }
 
+TEST_F(LidarObstacleManagerTest, addObstacleMergesIntoFirstCloseObstacle) {
+    LidarObstacleManager obstacle_manager(
+    0.3, 1.8, 2, 0.4, 3.0, 3.1415, 1.57, 1.30, 0.5, true);
+    obstacle_manager.addObstacle(LidarObstacle(0.4, {{0, 1}}));
+    obstacle_manager.addObstacle(LidarObstacle(0.4, {{0.5, 1}}));
+
+    // Close to both saved obstacles
+    obstacle_manager.addObstacle(LidarObstacle(0.4, {{0.25, 1}}));
+
+    std::vector<LidarObstacle> obstacles = obstacle_manager.getObstacles();
+    ASSERT_EQ(2, obstacles.size());
+    EXPECT_EQ(2, obstacles[0].getAllLaserReadings().size());
+    EXPECT_EQ(1, obstacles[1].getAllLaserReadings().size());
+}
+
+TEST_F(LidarObstacleManagerTest, addLaserScanMatchesPairwiseMerging) {
+    double max_obstacle_merging_distance = 0.3;
+    double min_wall_length               = 0.4;
+    LidarObstacleManager obstacle_manager(max_obstacle_merging_distance,
+                                          1.8,
+                                          2,
+                                          min_wall_length,
+                                          3.0,
+                                          3.1415,
+                                          1.57,
+                                          1.30,
+                                          0.5,
+                                          true);
+
+    // A scan of random walls and cones
+    sensor_msgs::LaserScan scan;
+    scan.angle_min       = -M_PI / 2;
+    scan.angle_increment = M_PI / 1000;
+    scan.range_min       = 0.02;
+    scan.range_max       = 5.6;
+    srand(42);
+    float range = 2;
+    for (int i = 0; i < 1000; i++) {
+        if (rand() % 20 == 0) { range = 0.5 + (rand() % 500) / 100.0; }
+        scan.ranges.push_back(range + (rand() % 100) / 1000.0);
+    }
+
+    // Merge every beam by comparing it with every saved obstacle
+    std::vector<LidarObstacle> expected;
+    for (int i = 0; i < scan.ranges.size(); i++) {
+        LidarObstacle obstacle(
+        min_wall_length,
+        {{scan.angle_min + i * scan.angle_increment, scan.ranges[i]}});
+        auto saved_obstacle = std::find_if(
+        expected.begin(), expected.end(), [&](LidarObstacle& saved) {
+            return LidarObstacleManager::minDistanceBetweenObstacles(
+                   saved, obstacle) < max_obstacle_merging_distance;
+        });
+        if (saved_obstacle != expected.end()) {
+            saved_obstacle->mergeInLidarObstacle(obstacle);
+        } else {
+            expected.emplace_back(obstacle);
+        }
+    }
+
+    obstacle_manager.addLaserScan(scan);
+    std::vector<LidarObstacle> obstacles = obstacle_manager.getObstacles();
+
+    ASSERT_EQ(expected.size(), obstacles.size());
+    for (int i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].getAllLaserReadings().size(),
+                  obstacles[i].getAllLaserReadings().size());
+        EXPECT_EQ(expected[i].getObstacleType(),
+                  obstacles[i].getObstacleType());
+        EXPECT_NEAR(
+        expected[i].getCenter().x, obstacles[i].getCenter().x, 1e-5);
+        EXPECT_NEAR(
+        expected[i].getCenter().y, obstacles[i].getCenter().y, 1e-5);
+    }
+}
+
 TEST_F(LidarObstacleManagerTest, addLaserScanTest) {
     obstacle_manager_1.addLaserScan(scan1);
     std::vector<LidarObstacle> obstacles = obstacle_manager_1.getObstacles();
@@ -163,6 +239,32 @@ TEST_F(LidarObstacleManagerTest, getPointGroupingsTest) {
     EXPECT_EQ(std::vector<int>({1, 1, 2, 3}), sizes);
 }
 
+TEST_F(LidarObstacleManagerTest, getPointGroupIndicesTest) {
+    std::vector<Point> points = {
+    {0, 0}, {0, 1}, {10, 0}, {1, 2.2}, {1, 1}, {11, 0}, {15, 15},
+    };
+    std::vector<std::vector<size_t>> groups =
+    obstacle_manager_1.getPointGroupIndices(points, 1.1);
+
+    std::vector<std::vector<size_t>> expected = {
+    {0, 1, 4}, {2, 5}, {3}, {6},
+    };
+    EXPECT_EQ(expected, groups);
+}
+
+TEST_F(LidarObstacleManagerTest, getPointGroupIndicesJoinsGroupsTest) {
+    // The last point connects the first two
+    std::vector<Point> points = {{0, 0}, {2, 0}, {1, 0}};
+    std::vector<std::vector<size_t>> groups =
+    obstacle_manager_1.getPointGroupIndices(points, 1.1);
+
+    EXPECT_EQ(std::vector<std::vector<size_t>>({{0, 1, 2}}), groups);
+}
+
+TEST_F(LidarObstacleManagerTest, getPointGroupIndicesNoPointsTest) {
+    EXPECT_TRUE(obstacle_manager_1.getPointGroupIndices({}, 1.1).empty());
+}
+
 TEST_F(LidarObstacleManagerTest, getLineOfBestFitPositiveSlopeTest) {
     std::vector<Point> points = {
     {0, 0}, {1, 0.5}, {2, 1},
@@ -212,7 +314,9 @@ TEST_F(LidarObstacleManagerTest, getLineOfBestFitRandomPoints3) {
     };
     LineOfBestFit line = LidarObstacleManager::getLineOfBestFit(points);
     EXPECT_DOUBLE_EQ(0.96926393150820644, line.getSlope());
-    EXPECT_DOUBLE_EQ(-101.27209579731976, line.getYIntercept());
+    // The exact intercept is -101.27209579731854. Rounding puts both the
+    // single pass and the old sum of squares fit within ~1e-12 of it
+    EXPECT_NEAR(-101.27209579731854, line.getYIntercept(), 1e-11);
     EXPECT_DOUBLE_EQ(0.98463989293624832, line.correlation);
 }
 
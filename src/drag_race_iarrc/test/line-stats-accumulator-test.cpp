@@ -0,0 +1,96 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for LineStatsAccumulator
+ */
+
+#include <LineStatsAccumulator.h>
+#include <cmath>
+#include <gtest/gtest.h>
+
+TEST(LineStatsAccumulatorTest, fitsPointsOnALine) {
+    LineStatsAccumulator stats;
+    stats.add({0, 1});
+    stats.add({1, 0.5});
+    stats.add({2, 0});
+
+    EXPECT_EQ(3, stats.count());
+    EXPECT_DOUBLE_EQ(1, stats.getMeanX());
+    EXPECT_DOUBLE_EQ(0.5, stats.getMeanY());
+    EXPECT_DOUBLE_EQ(-0.5, stats.getSlope());
+    EXPECT_DOUBLE_EQ(1, stats.getYIntercept());
+    EXPECT_DOUBLE_EQ(-1, stats.getCorrelation());
+}
+
+TEST(LineStatsAccumulatorTest, staysAccurateFarFromOrigin) {
+    // Summing squares of these directly loses most of the precision
+    LineStatsAccumulator stats;
+    double offset = 1e8;
+    stats.add({offset + 0, offset + 0});
+    stats.add({offset + 1, offset + 2.5});
+    stats.add({offset + 2, offset + 3.5});
+    stats.add({offset + 3, offset + 6});
+
+    EXPECT_NEAR(1.9, stats.getSlope(), 1e-6);
+    EXPECT_NEAR(0.98776, stats.getCorrelation(), 1e-5);
+}
+
+TEST(LineStatsAccumulatorTest, mergeMatchesAddingEveryPoint) {
+    std::vector<Point> points = {
+    {0, -1}, {1, -0.5}, {2, 2.3}, {3, -3}, {3, -8}, {4, 9}, {5, 100}};
+
+    LineStatsAccumulator all, first, second;
+    for (int i = 0; i < points.size(); i++) {
+        all.add(points[i]);
+        (i < 3 ? first : second).add(points[i]);
+    }
+    first.merge(second);
+
+    EXPECT_EQ(all.count(), first.count());
+    EXPECT_NEAR(all.getMeanX(), first.getMeanX(), 1e-12);
+    EXPECT_NEAR(all.getMeanY(), first.getMeanY(), 1e-12);
+    EXPECT_NEAR(all.getSlope(), first.getSlope(), 1e-12);
+    EXPECT_NEAR(all.getYIntercept(), first.getYIntercept(), 1e-12);
+    EXPECT_NEAR(all.getCorrelation(), first.getCorrelation(), 1e-12);
+}
+
+TEST(LineStatsAccumulatorTest, mergeWithEmpty) {
+    LineStatsAccumulator stats, empty;
+    stats.add({0, 0});
+    stats.add({1, 2});
+
+    stats.merge(empty);
+    EXPECT_EQ(2, stats.count());
+    EXPECT_DOUBLE_EQ(2, stats.getSlope());
+
+    empty.merge(stats);
+    EXPECT_EQ(2, empty.count());
+    EXPECT_DOUBLE_EQ(2, empty.getSlope());
+
+    stats.clear();
+    EXPECT_EQ(0, stats.count());
+}
+
+TEST(LineStatsAccumulatorTest, transformMatchesTransformingEveryPoint) {
+    std::vector<Point> points = {{0, 1}, {1, 0.5}, {2, 2}, {3, -4}, {3, -5}};
+    double angle = 0.7, dx = 3, dy = -2;
+
+    LineStatsAccumulator transformed, expected;
+    for (const Point& p : points) {
+        transformed.add(p);
+        expected.add({std::cos(angle) * p.x - std::sin(angle) * p.y + dx,
+                      std::sin(angle) * p.x + std::cos(angle) * p.y + dy});
+    }
+    transformed.transform(angle, dx, dy);
+
+    EXPECT_NEAR(expected.getMeanX(), transformed.getMeanX(), 1e-12);
+    EXPECT_NEAR(expected.getMeanY(), transformed.getMeanY(), 1e-12);
+    EXPECT_NEAR(expected.getSlope(), transformed.getSlope(), 1e-12);
+    EXPECT_NEAR(expected.getYIntercept(), transformed.getYIntercept(), 1e-12);
+    EXPECT_NEAR(expected.getCorrelation(), transformed.getCorrelation(), 1e-12);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for SpatialHash
+ */
+
+#include <SpatialHash.h>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+static std::vector<size_t>
+valuesNear(const SpatialHash& hash, const Point& point, double distance) {
+    std::vector<size_t> values;
+    hash.forEachNear(point, [&](const Point& p, size_t value) {
+        if (distanceBetweenPoints(point, p) <= distance) {
+            values.push_back(value);
+        }
+    });
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+TEST(SpatialHashTest, findsEveryPointWithinACellSize) {
+    SpatialHash hash(1);
+    hash.insert({0, 0}, 0);
+    hash.insert({0.9, 0}, 1);
+    hash.insert({-0.5, -0.5}, 2);
+    hash.insert({0, 1.5}, 3);
+    hash.insert({100, 100}, 4);
+
+    EXPECT_EQ(std::vector<size_t>({0, 1, 2}), valuesNear(hash, {0, 0}, 1));
+    EXPECT_EQ(std::vector<size_t>({3}), valuesNear(hash, {0, 2.4}, 1));
+    EXPECT_EQ(std::vector<size_t>({4}), valuesNear(hash, {100.5, 99.5}, 1));
+}
+
+TEST(SpatialHashTest, findsPointsAcrossNegativeCells) {
+    SpatialHash hash(0.3);
+    hash.insert({-0.01, -0.01}, 0);
+    hash.insert({0.01, 0.01}, 1);
+
+    EXPECT_EQ(std::vector<size_t>({0, 1}), valuesNear(hash, {0, 0}, 0.3));
+}
+
+TEST(SpatialHashTest, clearRemovesAllPoints) {
+    SpatialHash hash(1);
+    hash.insert({0, 0}, 0);
+    hash.clear();
+    EXPECT_TRUE(valuesNear(hash, {0, 0}, 1).empty());
+
+    hash.insert({0, 0}, 1);
+    hash.setCellSize(2);
+    EXPECT_TRUE(valuesNear(hash, {0, 0}, 2).empty());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -8,8 +8,10 @@
 #define LASERSCAN_CONE_MANAGER_H
 
 #include <ConeIdentification.h>
+#include <ConeTracker.h>
 #include <RvizUtils.h>
 #include <iostream>
+#include <mapping_igvc/ConeObstacleArray.h>
 #include <ros/ros.h>
 #include <sb_utils.h>
 #include <sensor_msgs/LaserScan.h>
@@ -22,13 +24,14 @@ class ConeExtractorNode {
   private:
     ros::Subscriber laser_subscriber;
     ros::Publisher cone_publisher;
+    ros::Publisher cone_array_publisher;
     ros::Publisher rviz_publisher;
 
     /**
-     * Callback function for receiving laser scan msgs. Publishes the cones
-     * found in the laserscan to
-     * the correct topic one by one. Note that the coordinates for cones are in
-     * the base-link (robot frame)
+     * Callback function for receiving laser scan msgs. Publishes all the cones
+     * found in the laserscan together in one message, and to the correct topic
+     * one by one if anyone is subscribed to it. Note that the coordinates for
+     * cones are in the base-link (robot frame)
      * @param ptr
      */
     void laserCallBack(const sensor_msgs::LaserScan::ConstPtr& ptr);
@@ -38,7 +41,7 @@ class ConeExtractorNode {
      * @param cone
      * @return a visualization marker
      */
-    void publishMarkers(std::vector<mapping_igvc::ConeObstacle> cones);
+    void publishMarkers(const std::vector<mapping_igvc::ConeObstacle>& cones);
 
     double cone_dist_tol;   // Distance tolerance between cones in cluster
     double cone_rad_exp;    // Expected cone radius
@@ -47,6 +50,17 @@ class ConeExtractorNode {
     int min_points_in_cone; // Index difference between points used in edge
                             // cluster splitting algorithm
     double ang_threshold;   // Max angle needed to split edge clusters
+
+    // Identifies cones, keeping its buffers between scans
+    ConeIdentification cone_identifier;
+
+    // Follows the cones across scans, so they keep their ids and survive
+    // missed detections. Only used if use_tracking is set
+    ConeTracker tracker;
+    bool use_tracking;
+
+    // Cones found in the latest scan, reused between scans
+    std::vector<mapping_igvc::ConeObstacle> cones;
 };
 
 #endif // LASERSCAN_CONE_MANAGER_H
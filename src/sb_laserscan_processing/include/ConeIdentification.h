@@ -1,11 +1,13 @@
 /**
  * Created by William Gu on 24/03/18.
  * Class declaration for Cone Identification, which contains static methods for
- * identifying cones in a laser message
+ * identifying cones in a laser message, and an instance version that reuses
+ * its buffers across scans
  */
 #ifndef CONEIDENTIFICATION_H
 #define CONEIDENTIFICATION_H
 
+#include <LaserScanProjector.h>
 #include <iostream>
 #include <mapping_igvc/ConeObstacle.h>
 #include <mapping_igvc/Point2D.h>
@@ -13,8 +15,89 @@
 #include <ros/ros.h>
 #include <sensor_msgs/LaserScan.h>
 
+/**
+ * A read-only view of a contiguous range of points, so that edge clusters and
+ * their splits can be passed around without copying the points
+ */
+class PointSpan {
+  public:
+    PointSpan() : first(nullptr), count(0) {}
+
+    PointSpan(const mapping_igvc::Point2D* first, size_t count)
+      : first(first), count(count) {}
+
+    PointSpan(const std::vector<mapping_igvc::Point2D>& points)
+      : first(points.data()), count(points.size()) {}
+
+    const mapping_igvc::Point2D* begin() const { return first; }
+    const mapping_igvc::Point2D* end() const { return first + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    const mapping_igvc::Point2D& operator[](size_t i) const { return first[i]; }
+    const mapping_igvc::Point2D& back() const { return first[count - 1]; }
+
+    /**
+     * A view of the points in [offset, offset + length)
+     */
+    PointSpan subspan(size_t offset, size_t length) const {
+        return PointSpan(first + offset, length);
+    }
+
+  private:
+    const mapping_igvc::Point2D* first;
+    size_t count;
+};
+
 class ConeIdentification {
   public:
+    /**
+     * Constructs a cone identifier with the given parameters, see the static
+     * identifyCones for their meaning
+     * @param parallel whether identifyCones splits and fits the segments of
+     * a scan in parallel, which pays off for scans with many beams
+     */
+    ConeIdentification(double dist_tol        = 0.01,
+                       double radius_exp      = 0.3,
+                       double radius_tol      = 0.1,
+                       int min_points_in_cone = 5,
+                       double ang_threshold   = 2.3,
+                       bool parallel          = false);
+
+    /**
+     * Identifies the cones in a given laserscan message, with the same results
+     * as the static identifyCones.
+     *
+     * The scan is converted to points once, into a buffer kept between scans,
+     * and each edge cluster and split is a view into that buffer. Once the
+     * buffers have grown to fit the largest scan seen, no memory is
+     * allocated per scan apart from the frame id of each cone found.
+     *
+     * In parallel mode, the segments of the scan are split and fitted
+     * concurrently, and their cones are merged back in scan order, so the
+     * results are the same as in sequential mode. Each thread splits with its
+     * own buffers, which are also kept between scans.
+     *
+     * @param laser_msg laserscan message to analyze
+     * @param identified_cones cleared, then filled with the cones found
+     */
+    void
+    identifyCones(const sensor_msgs::LaserScan& laser_msg,
+                  std::vector<mapping_igvc::ConeObstacle>& identified_cones);
+
+    /**
+     * Finds the edge clusters in a laserscan message that could each be one
+     * cone, split the same way as in identifyCones, without fitting a cone to
+     * any of them
+     *
+     * @param laser_msg laserscan message to analyze
+     * @return views of the edge clusters, in the order they appear in the
+     * scan. They point into buffers of this object, so are only valid until
+     * the next scan is analyzed
+     */
+    const std::vector<PointSpan>&
+    findEdgeClusters(const sensor_msgs::LaserScan& laser_msg);
+
     /**
      * Identifies the cones in a given laserscan message. Note that all cones
      * will have radius of the expected radius, and only cones that
@@ -57,12 +140,12 @@ class ConeIdentification {
      */
     static void addConesInEdgeCluster(
     std::vector<mapping_igvc::ConeObstacle>& identified_cones,
-    std::vector<mapping_igvc::Point2D>& edge_points,
+    PointSpan edge_points,
     double radius_exp,
     double radius_tol,
     int min_points_in_cone,
     double ang_threshold,
-    std::string frame_id);
+    const std::string& frame_id);
 
     /**
     * Splits a cluster of edge points such that points forming multiple cones
@@ -75,9 +158,26 @@ class ConeIdentification {
     * @return a vector consisting of split edge point vectors
     */
     static std::vector<std::vector<mapping_igvc::Point2D>>
-    splitEdge(const std::vector<mapping_igvc::Point2D>& edge_points,
-              int line_point_dist,
-              double ang_threshold);
+    splitEdge(PointSpan edge_points, int line_point_dist, double ang_threshold);
+
+    /**
+     * Finds where to split a cluster of edge points, as in splitEdge, without
+     * copying any points. Split i is edge_points[split_indices[i - 1]] to
+     * edge_points[split_indices[i]] inclusive, where the first split starts
+     * at 0 and the last one ends at the last point.
+     * @param edge_points
+     * @param line_point_dist the number of points to take before and after each
+     * edge point to form a line and test angle
+     * @param ang_threshold the max angle for a split to be considered (in
+     * radians)
+     * @param angles buffer for the angle at each point
+     * @param split_indices set to the indices to split at
+     */
+    static void findSplitIndices(PointSpan edge_points,
+                                 int line_point_dist,
+                                 double ang_threshold,
+                                 std::vector<double>& angles,
+                                 std::vector<size_t>& split_indices);
 
     /**
     * Converts a cluster of edge points to a cone obstacle with a predicted
@@ -86,8 +186,7 @@ class ConeIdentification {
     * in the object
     * @return a cone formed by edge points
     */
-    static mapping_igvc::ConeObstacle
-    edgeToCone(const std::vector<mapping_igvc::Point2D>& edge_points);
+    static mapping_igvc::ConeObstacle edgeToCone(PointSpan edge_points);
 
     /**
     * Converts a laserscan reading to a point
@@ -112,24 +211,101 @@ class ConeIdentification {
      * @param edge_points
      * @return mean x coordinate
      */
-    static double
-    getMeanX(const std::vector<mapping_igvc::Point2D>& edge_points);
+    static double getMeanX(PointSpan edge_points);
 
     /**
      * Get the mean y coordinate of points in edge_points
      * @param edge_points
      * @return mean y coordinate
      */
-    static double
-    getMeanY(const std::vector<mapping_igvc::Point2D>& edge_points);
+    static double getMeanY(PointSpan edge_points);
 
     /**
      * Get the slope of the regression line formed by points in edge_points
      * @param edge_points
      * @return slope of line
      */
-    static double
-    getRegressionSlope(const std::vector<mapping_igvc::Point2D>& edge_points);
+    static double getRegressionSlope(PointSpan edge_points);
+
+  private:
+    /**
+     * Breaks a scan into segments of consecutive valid points, each within
+     * dist_tol of the one before it. Each segment is an edge cluster that
+     * still has to be split.
+     */
+    void findSegments(const sensor_msgs::LaserScan& laser_msg);
+
+    /**
+     * Splits and fits the segments on OpenMP threads, then merges their
+     * cones in scan order
+     */
+    void identifyConesParallel(
+    std::vector<mapping_igvc::ConeObstacle>& identified_cones,
+    const std::string& frame_id,
+    const ros::Time& stamp);
+
+    /**
+     * Splits a cluster of edge points as in addConesInEdgeCluster, using the
+     * given buffers, and adds each split with enough points to be a cone to
+     * edge_clusters
+     */
+    static void addEdgeClusterSplits(PointSpan edge_points,
+                                     int min_points_in_cone,
+                                     double ang_threshold,
+                                     std::vector<double>& angles,
+                                     std::vector<size_t>& split_indices,
+                                     std::vector<PointSpan>& edge_clusters);
+
+    /**
+     * Adds the cone formed by edge points if its radius is close enough to
+     * the expected radius
+     */
+    static void
+    addConeIfValid(std::vector<mapping_igvc::ConeObstacle>& identified_cones,
+                   PointSpan edge_points,
+                   double radius_exp,
+                   double radius_tol,
+                   const std::string& frame_id,
+                   const ros::Time& stamp);
+
+    double dist_tol;
+    double radius_exp;
+    double radius_tol;
+    int min_points_in_cone;
+    double ang_threshold;
+    bool parallel;
+
+    // Converts scans to points with cached sin/cos tables
+    snowbots::LaserScanProjector projector;
+    std::vector<double> scan_x;
+    std::vector<double> scan_y;
+
+    // The scan converted to points, one per beam, reused across scans
+    std::vector<mapping_igvc::Point2D> scan_points;
+
+    // Squared distance from each beam to the beam before it, and the
+    // segments of the latest scan
+    std::vector<double> neighbour_dist2;
+    std::vector<PointSpan> segments;
+
+    // The cones found in each segment in parallel mode, before merging
+    std::vector<std::vector<mapping_igvc::ConeObstacle>> segment_cones;
+
+    // Buffers for splitting edge clusters, reused across clusters and scans
+    std::vector<double> angles;
+    std::vector<size_t> split_indices;
+
+    // The same buffers for each OpenMP thread in parallel mode, indexed by
+    // thread number
+    struct SplitBuffers {
+        std::vector<double> angles;
+        std::vector<size_t> split_indices;
+        std::vector<PointSpan> edge_clusters;
+    };
+    std::vector<SplitBuffers> thread_buffers;
+
+    // The edge clusters found in the latest scan
+    std::vector<PointSpan> edge_clusters;
 };
 
 #endif // CONEIDENTIFICATION_H
@@ -0,0 +1,166 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Class declaration for ConeTracker, which follows the cones
+ *              found in previous scans so that they keep the same identity,
+ *              survive missed detections, and can be updated without fitting
+ *              a circle from scratch every scan
+ */
+
+#ifndef SB_LASERSCAN_PROCESSING_CONETRACKER_H
+#define SB_LASERSCAN_PROCESSING_CONETRACKER_H
+
+#include <ConeIdentification.h>
+#include <mapping_igvc/ConeObstacle.h>
+#include <std_msgs/Header.h>
+#include <vector>
+
+/**
+ * A cone that has been seen in one or more scans
+ */
+struct ConeTrack {
+    // Identifier that stays the same for as long as the cone is tracked
+    unsigned int id;
+
+    // Estimated center of the cone, in the frame of the scans
+    double x;
+    double y;
+
+    // Variance of the estimated center, the same along x and y
+    double variance;
+
+    // Number of scans the cone has been seen in
+    unsigned int hits;
+
+    // Number of consecutive scans in which the cone was not seen
+    unsigned int missed_frames;
+};
+
+class ConeTracker {
+  public:
+    /**
+     * @param radius_exp expected cone radius
+     * @param radius_tol max difference between the expected radius and the
+     * radius of a fitted cone for it to be accepted
+     * @param gate_distance how far a cone may be from a track's center to be
+     * associated with that track
+     * @param process_noise variance added to every track's center each scan,
+     * for the cone (or the robot) moving
+     * @param measurement_noise variance of a cone center fitted from a scan
+     * @param min_hits number of scans a track must be seen in before it is
+     * reported as a cone
+     * @param max_missed_frames a track is dropped once it has not been seen
+     * for more than this many consecutive scans
+     */
+    ConeTracker(double radius_exp              = 0.3,
+                double radius_tol              = 0.1,
+                double gate_distance           = 0.3,
+                double process_noise           = 0.01,
+                double measurement_noise       = 0.01,
+                unsigned int min_hits          = 2,
+                unsigned int max_missed_frames = 3);
+
+    /**
+     * Updates the tracks with the edge clusters found in a new scan
+     *
+     * Each cluster is associated with the nearest unmatched track close
+     * enough to it, found through a spatial hash of the tracks. A matched
+     * cluster only refines the track's center, fitting a circle of the
+     * expected radius starting from it. A circle is fitted from scratch
+     * (with ConeIdentification::edgeToCone) only for clusters that match no
+     * track or don't fit their track's cone, and the valid cones among them
+     * update a nearby track (even one already matched in this scan, or
+     * started by an earlier cluster of it) or start a new one.
+     *
+     * @param edge_clusters the edge clusters of the scan, as found by
+     * ConeIdentification::findEdgeClusters
+     */
+    void update(const std::vector<PointSpan>& edge_clusters);
+
+    /**
+     * Gets a cone for every track seen in at least min_hits scans, including
+     * the tracks that were missed in the latest scans but not yet dropped
+     *
+     * @param header header given to each cone
+     * @param cones cleared, then filled with the cones
+     */
+    void getCones(const std_msgs::Header& header,
+                  std::vector<mapping_igvc::ConeObstacle>& cones) const;
+
+    /**
+     * @return all current tracks, confirmed or not
+     */
+    const std::vector<ConeTrack>& getTracks() const { return tracks; }
+
+    /**
+     * Drops all tracks
+     */
+    void clear() { tracks.clear(); }
+
+  private:
+    /**
+     * Fits a circle of the expected radius to a cluster by Gauss-Newton,
+     * starting from the center of a track
+     * @param x set to the x of the fitted center
+     * @param y set to the y of the fitted center
+     * @return true if the circle fits the cluster well enough, and is within
+     * the gate distance of the track
+     */
+    bool refitFromTrack(PointSpan edge_cluster,
+                        const ConeTrack& track,
+                        double& x,
+                        double& y) const;
+
+    /**
+     * Finds the nearest track whose center is within max_dist of (x, y)
+     * @param skip_matched whether to skip the tracks already matched in this
+     * scan
+     * @return the index of the track, or the number of tracks if there is
+     * none. max_dist must be at most the grid's cell size
+     */
+    size_t findNearestTrack(double x,
+                            double y,
+                            double max_dist,
+                            bool skip_matched) const;
+
+    /**
+     * Kalman update of a track's center with a measured center
+     */
+    void correct(ConeTrack& track, double x, double y) const;
+
+    /**
+     * Puts the index of every track in the grid cell of its center
+     */
+    void buildGrid();
+
+    /**
+     * Puts the index of a track in the grid cell of its center
+     */
+    void addToGrid(size_t index);
+
+    /**
+     * @return the index of the bucket holding the grid cell (cell_x, cell_y)
+     */
+    size_t getBucket(long cell_x, long cell_y) const;
+
+    double radius_exp;
+    double radius_tol;
+    double gate_distance;
+    double process_noise;
+    double measurement_noise;
+    unsigned int min_hits;
+    unsigned int max_missed_frames;
+
+    std::vector<ConeTrack> tracks;
+    unsigned int next_id;
+
+    // Whether each track was matched to a cluster in the current scan
+    std::vector<bool> matched;
+
+    // Spatial hash of the tracks: the indices of the tracks in each grid
+    // cell, with the cells hashed into a fixed number of buckets
+    double cell_size;
+    std::vector<std::vector<size_t>> buckets;
+};
+
+#endif // SB_LASERSCAN_PROCESSING_CONETRACKER_H
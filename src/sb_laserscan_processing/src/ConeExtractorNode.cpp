@@ -42,6 +42,67 @@ ConeExtractorNode::ConeExtractorNode(int argc,
     SB_getParam(
     private_nh, ang_threshold_param, ang_threshold, default_ang_threshold);
 
+    std::string parallel_segmentation_param = "parallel_segmentation";
+    bool default_parallel_segmentation      = false;
+    bool parallel_segmentation;
+    SB_getParam(private_nh,
+                parallel_segmentation_param,
+                parallel_segmentation,
+                default_parallel_segmentation);
+
+    cone_identifier = ConeIdentification(cone_dist_tol,
+                                         cone_rad_exp,
+                                         cone_rad_tol,
+                                         min_points_in_cone,
+                                         ang_threshold,
+                                         parallel_segmentation);
+
+    std::string use_tracking_param = "use_tracking";
+    bool default_use_tracking      = false;
+    SB_getParam(
+    private_nh, use_tracking_param, use_tracking, default_use_tracking);
+
+    std::string gate_distance_param = "tracking_gate_distance";
+    double default_gate_distance    = 0.3;
+    double gate_distance;
+    SB_getParam(
+    private_nh, gate_distance_param, gate_distance, default_gate_distance);
+
+    std::string process_noise_param = "tracking_process_noise";
+    double default_process_noise    = 0.01;
+    double process_noise;
+    SB_getParam(
+    private_nh, process_noise_param, process_noise, default_process_noise);
+
+    std::string measurement_noise_param = "tracking_measurement_noise";
+    double default_measurement_noise    = 0.01;
+    double measurement_noise;
+    SB_getParam(private_nh,
+                measurement_noise_param,
+                measurement_noise,
+                default_measurement_noise);
+
+    std::string min_hits_param = "tracking_min_hits";
+    int default_min_hits       = 2;
+    int min_hits;
+    SB_getParam(private_nh, min_hits_param, min_hits, default_min_hits);
+
+    std::string max_missed_frames_param = "tracking_max_missed_frames";
+    int default_max_missed_frames       = 3;
+    int max_missed_frames;
+    SB_getParam(private_nh,
+                max_missed_frames_param,
+                max_missed_frames,
+                default_max_missed_frames);
+
+    tracker = ConeTracker(cone_rad_exp,
+                          cone_rad_tol,
+                          gate_distance,
+                          process_noise,
+                          measurement_noise,
+                          min_hits,
+                          max_missed_frames);
+
     std::string subscribe_topic =
     "/robot/laser/scan"; // Setup subscriber to laserscan (Placeholder)
     laser_subscriber = nh.subscribe(
@@ -51,6 +112,12 @@ ConeExtractorNode::ConeExtractorNode(int argc,
     cone_publisher = private_nh.advertise<mapping_igvc::ConeObstacle>(
     output_cone_topic, queue_size);
 
+    // All cones found in a scan, published together in one message
+    std::string output_cone_array_topic = "output_cone_obstacles";
+    cone_array_publisher =
+    private_nh.advertise<mapping_igvc::ConeObstacleArray>(
+    output_cone_array_topic, queue_size);
+
     std::string marker_topic = "markers"; // Placeholder
     rviz_publisher =
     private_nh.advertise<visualization_msgs::Marker>(marker_topic, queue_size);
@@ -58,23 +125,34 @@ ConeExtractorNode::ConeExtractorNode(int argc,
 
 void ConeExtractorNode::laserCallBack(
 const sensor_msgs::LaserScan::ConstPtr& ptr) {
-    sensor_msgs::LaserScan laser_msg = *ptr;
-
-    std::vector<mapping_igvc::ConeObstacle> cones =
-    ConeIdentification::identifyCones(laser_msg,
-                                      cone_dist_tol,
-                                      cone_rad_exp,
-                                      cone_rad_tol,
-                                      min_points_in_cone,
-                                      ang_threshold);
-    for (int i = 0; i < cones.size(); i++) { // Publish cones individually
-        cone_publisher.publish(cones[i]);
+    if (use_tracking) {
+        tracker.update(cone_identifier.findEdgeClusters(*ptr));
+        tracker.getCones(ptr->header, cones);
+    } else {
+        cone_identifier.identifyCones(*ptr, cones);
     }
-    publishMarkers(cones);
+
+    // Only pay for one message per cone if someone is listening for them
+    if (cone_publisher.getNumSubscribers() > 0) {
+        for (int i = 0; i < cones.size(); i++) { // Publish cones individually
+            cone_publisher.publish(cones[i]);
+        }
+    }
+
+    // Swap the cones in and back out rather than copying them, so the
+    // identified cones keep their buffer for the next scan
+    mapping_igvc::ConeObstacleArray cone_array;
+    cone_array.header = ptr->header;
+    cone_array.obstacles.swap(cones);
+    cone_array_publisher.publish(cone_array);
+    cone_array.obstacles.swap(cones);
+
+    // Building markers is wasted work if rviz isn't listening
+    if (rviz_publisher.getNumSubscribers() > 0) { publishMarkers(cones); }
 }
 
 void ConeExtractorNode::publishMarkers(
-std::vector<mapping_igvc::ConeObstacle> cones) {
+const std::vector<mapping_igvc::ConeObstacle>& cones) {
     if (cones.empty()) return;
 
     visualization_msgs::Marker marker;
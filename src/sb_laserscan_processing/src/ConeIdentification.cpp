@@ -5,6 +5,21 @@
  */
 
 #include <ConeIdentification.h>
+#include <algorithm>
+#include <omp.h>
+
+ConeIdentification::ConeIdentification(double dist_tol,
+                                       double radius_exp,
+                                       double radius_tol,
+                                       int min_points_in_cone,
+                                       double ang_threshold,
+                                       bool parallel)
+  : dist_tol(dist_tol),
+    radius_exp(radius_exp),
+    radius_tol(radius_tol),
+    min_points_in_cone(min_points_in_cone),
+    ang_threshold(ang_threshold),
+    parallel(parallel) {}
 
 std::vector<mapping_igvc::ConeObstacle>
 ConeIdentification::identifyCones(const sensor_msgs::LaserScan& laser_msg,
@@ -14,112 +29,250 @@ ConeIdentification::identifyCones(const sensor_msgs::LaserScan& laser_msg,
                                   int min_points_in_cone,
                                   double ang_threshold) {
     std::vector<mapping_igvc::ConeObstacle> identified_cones;
-    std::vector<mapping_igvc::Point2D>
-    edge_points; // Represents points in a potential cluster
-    std::string frame_id = laser_msg.header.frame_id;
+    ConeIdentification(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold)
+    .identifyCones(laser_msg, identified_cones);
+    return identified_cones;
+}
+
+void ConeIdentification::identifyCones(
+const sensor_msgs::LaserScan& laser_msg,
+std::vector<mapping_igvc::ConeObstacle>& identified_cones) {
+    identified_cones.clear();
+
+    const std::string& frame_id = laser_msg.header.frame_id;
+    ros::Time stamp             = ros::Time::now();
+
+    if (parallel) {
+        findSegments(laser_msg);
+        identifyConesParallel(identified_cones, frame_id, stamp);
+        return;
+    }
+
+    for (const PointSpan& edge_cluster : findEdgeClusters(laser_msg)) {
+        addConeIfValid(identified_cones,
+                       edge_cluster,
+                       radius_exp,
+                       radius_tol,
+                       frame_id,
+                       stamp);
+    }
+}
+
+const std::vector<PointSpan>&
+ConeIdentification::findEdgeClusters(const sensor_msgs::LaserScan& laser_msg) {
+    edge_clusters.clear();
+
+    findSegments(laser_msg);
+    for (const PointSpan& segment : segments) {
+        addEdgeClusterSplits(segment,
+                             min_points_in_cone,
+                             ang_threshold,
+                             angles,
+                             split_indices,
+                             edge_clusters);
+    }
+
+    return edge_clusters;
+}
+
+void ConeIdentification::findSegments(const sensor_msgs::LaserScan& laser_msg) {
+    segments.clear();
 
     int numIndices =
     (laser_msg.angle_max - laser_msg.angle_min) / laser_msg.angle_increment;
+    numIndices = std::min(numIndices, (int) laser_msg.ranges.size());
+    if (numIndices <= 0) return;
+
+    // Only grow when a scan has more beams than any scan before it
+    scan_points.resize(numIndices);
+    neighbour_dist2.resize(numIndices);
+    projector.project(laser_msg, scan_x, scan_y);
+
+    // Squared distances between neighbouring beams, in a plain loop over raw
+    // arrays so the compiler can vectorize it (sqrt may set errno, which
+    // would stop it from being vectorized)
+    const double* __restrict x = scan_x.data();
+    const double* __restrict y = scan_y.data();
+    double* __restrict dist2   = neighbour_dist2.data();
+    dist2[0]                   = 0;
+    for (int i = 1; i < numIndices; i++) {
+        double dx = x[i] - x[i - 1];
+        double dy = y[i] - y[i - 1];
+        dist2[i]  = dx * dx + dy * dy;
+    }
+
+    for (int i = 0; i < numIndices; i++) { // Convert to x-y points
+        scan_points[i].x = x[i];
+        scan_points[i].y = y[i];
+    }
+
+    // The current segment is scan_points[segment_start, i), and is empty
+    // while segment_start is -1
+    double max_dist2  = dist_tol * dist_tol;
+    int segment_start = -1;
     for (int i = 0; i < numIndices; i++) {
         if (laser_msg.ranges[i] > laser_msg.range_max ||
             laser_msg.ranges[i] <
             laser_msg
             .range_min) { // Check if curr laserscan point is in invalid range
-            addConesInEdgeCluster(identified_cones,
-                                  edge_points,
-                                  radius_exp,
-                                  radius_tol,
-                                  min_points_in_cone,
-                                  ang_threshold,
-                                  frame_id);
-            edge_points.clear();
-        } else { // Laserscan point in range
-
-            mapping_igvc::Point2D point =
-            laserToPoint(laser_msg.ranges[i],
-                         laser_msg.angle_min +
-                         i * laser_msg.angle_increment); // Convert to x-y point
-
-            if (!edge_points.empty() &&
-                getDist(edge_points.back(), point) >
-                dist_tol) { // If out of dist tolerance, analyze points so far,
-                            // clear, then add new point
-                addConesInEdgeCluster(identified_cones,
-                                      edge_points,
-                                      radius_exp,
-                                      radius_tol,
-                                      min_points_in_cone,
-                                      ang_threshold,
-                                      frame_id);
-                edge_points.clear();
-                edge_points.push_back(point);
-            } else if (i == numIndices - 1) { // If out of points, analyze edge
-                                              // points so far to create cone,
-                                              // and clear edge_points
-                edge_points.push_back(point);
-                addConesInEdgeCluster(identified_cones,
-                                      edge_points,
-                                      radius_exp,
-                                      radius_tol,
-                                      min_points_in_cone,
-                                      ang_threshold,
-                                      frame_id);
-                edge_points.clear();
-            } else {
-                edge_points.push_back(point);
+            if (segment_start >= 0) {
+                segments.emplace_back(&scan_points[segment_start],
+                                      i - segment_start);
             }
+            segment_start = -1;
+        } else if (segment_start < 0) {
+            segment_start = i;
+        } else if (neighbour_dist2[i] > max_dist2) { // Out of dist tolerance,
+                                                     // start a new segment
+                                                     // at this point
+            segments.emplace_back(&scan_points[segment_start],
+                                  i - segment_start);
+            segment_start = i;
         }
     }
-    return identified_cones;
+
+    // Out of points, add the last segment
+    if (segment_start >= 0) {
+        segments.emplace_back(&scan_points[segment_start],
+                              numIndices - segment_start);
+    }
+}
+
+void ConeIdentification::identifyConesParallel(
+std::vector<mapping_igvc::ConeObstacle>& identified_cones,
+const std::string& frame_id,
+const ros::Time& stamp) {
+    // Never shrink, so each segment's buffer keeps its memory between scans
+    if (segment_cones.size() < segments.size()) {
+        segment_cones.resize(segments.size());
+    }
+    if (thread_buffers.size() < (size_t) omp_get_max_threads()) {
+        thread_buffers.resize(omp_get_max_threads());
+    }
+
+#pragma omp parallel
+    {
+        // Every thread gets its own buffers for splitting
+        SplitBuffers& buffers = thread_buffers[omp_get_thread_num()];
+
+#pragma omp for schedule(dynamic)
+        for (int i = 0; i < (int) segments.size(); i++) {
+            segment_cones[i].clear();
+            buffers.edge_clusters.clear();
+            addEdgeClusterSplits(segments[i],
+                                 min_points_in_cone,
+                                 ang_threshold,
+                                 buffers.angles,
+                                 buffers.split_indices,
+                                 buffers.edge_clusters);
+
+            for (const PointSpan& edge_cluster : buffers.edge_clusters) {
+                addConeIfValid(segment_cones[i],
+                               edge_cluster,
+                               radius_exp,
+                               radius_tol,
+                               frame_id,
+                               stamp);
+            }
+        }
+    }
+
+    // Merge in scan order, so the result doesn't depend on which thread
+    // handled which segment
+    for (size_t i = 0; i < segments.size(); i++) {
+        identified_cones.insert(identified_cones.end(),
+                                segment_cones[i].begin(),
+                                segment_cones[i].end());
+    }
 }
 
 void ConeIdentification::addConesInEdgeCluster(
 std::vector<mapping_igvc::ConeObstacle>& identified_cones,
-std::vector<mapping_igvc::Point2D>& edge_points,
+PointSpan edge_points,
 double radius_exp,
 double radius_tol,
 int min_points_in_cone,
 double ang_threshold,
-std::string frame_id) {
+const std::string& frame_id) {
+    std::vector<double> angles;
+    std::vector<size_t> split_indices;
+    std::vector<PointSpan> edge_clusters;
+    addEdgeClusterSplits(edge_points,
+                         min_points_in_cone,
+                         ang_threshold,
+                         angles,
+                         split_indices,
+                         edge_clusters);
+
+    ros::Time stamp = ros::Time::now();
+    for (const PointSpan& edge_cluster : edge_clusters) {
+        addConeIfValid(identified_cones,
+                       edge_cluster,
+                       radius_exp,
+                       radius_tol,
+                       frame_id,
+                       stamp);
+    }
+}
+
+void ConeIdentification::addEdgeClusterSplits(
+PointSpan edge_points,
+int min_points_in_cone,
+double ang_threshold,
+std::vector<double>& angles,
+std::vector<size_t>& split_indices,
+std::vector<PointSpan>& edge_clusters) {
     if (edge_points.size() >=
         min_points_in_cone * 2 + 1) { // Needs minimum number of points to split
                                       // a potential multi-cone cluster
 
-        std::vector<std::vector<mapping_igvc::Point2D>> split_edges = splitEdge(
-        edge_points, min_points_in_cone, ang_threshold); // Split edge points if
-                                                         // multiple cones
-                                                         // detected (Temp
-                                                         // values right now as
-                                                         // params)
-
-        for (int i = 0; i < split_edges.size(); i++) {
-            if (split_edges[i].size() >= min_points_in_cone) {
-                mapping_igvc::ConeObstacle potential_cone =
-                edgeToCone(split_edges[i]);
-
-                if (fabs(potential_cone.radius - radius_exp) <=
-                    radius_tol) { // Within expected radius, valid cone
-
-                    potential_cone.radius          = radius_exp;
-                    potential_cone.header.frame_id = frame_id;
-                    potential_cone.header.stamp    = ros::Time::now();
-                    identified_cones.push_back(potential_cone);
-                }
+        findSplitIndices(edge_points,
+                         min_points_in_cone,
+                         ang_threshold,
+                         angles,
+                         split_indices); // Split edge points if multiple cones
+                                         // detected
+
+        // Neighbouring splits share the point they were split at
+        size_t lastIndex = 0;
+        for (size_t splitIndex : split_indices) {
+            PointSpan split =
+            edge_points.subspan(lastIndex, splitIndex + 1 - lastIndex);
+            if (split.size() >= min_points_in_cone) {
+                edge_clusters.push_back(split);
             }
+            lastIndex = splitIndex;
+        }
+
+        PointSpan lastSplit = edge_points.subspan(
+        lastIndex, edge_points.size() - lastIndex); // Last cluster of edges
+        if (lastSplit.size() >= min_points_in_cone) {
+            edge_clusters.push_back(lastSplit);
         }
     } else if (edge_points.size() >=
                min_points_in_cone) { // Directly make the cone if not enough
                                      // points to split (cone still needs at
                                      // least 3 edge points though)
-        mapping_igvc::ConeObstacle potential_cone = edgeToCone(edge_points);
-
-        if (fabs(potential_cone.radius - radius_exp) <=
-            radius_tol) { // Within expected radius, valid cone
-            potential_cone.radius          = radius_exp;
-            potential_cone.header.frame_id = frame_id;
-            potential_cone.header.stamp    = ros::Time::now();
-            identified_cones.push_back(potential_cone);
-        }
+        edge_clusters.push_back(edge_points);
+    }
+}
+
+void ConeIdentification::addConeIfValid(
+std::vector<mapping_igvc::ConeObstacle>& identified_cones,
+PointSpan edge_points,
+double radius_exp,
+double radius_tol,
+const std::string& frame_id,
+const ros::Time& stamp) {
+    mapping_igvc::ConeObstacle potential_cone = edgeToCone(edge_points);
+
+    if (fabs(potential_cone.radius - radius_exp) <=
+        radius_tol) { // Within expected radius, valid cone
+        potential_cone.radius          = radius_exp;
+        potential_cone.header.frame_id = frame_id;
+        potential_cone.header.stamp    = stamp;
+        identified_cones.push_back(potential_cone);
     }
 }
 
@@ -137,13 +290,36 @@ double ConeIdentification::getDist(const mapping_igvc::Point2D& p1,
 }
 
 std::vector<std::vector<mapping_igvc::Point2D>> ConeIdentification::splitEdge(
-const std::vector<mapping_igvc::Point2D>& edge_points,
-int min_points_in_cone,
-double ang_threshold) {
+PointSpan edge_points, int min_points_in_cone, double ang_threshold) {
+    std::vector<double> angles;
+    std::vector<size_t> splitIndices;
+    findSplitIndices(
+    edge_points, min_points_in_cone, ang_threshold, angles, splitIndices);
+
+    // Split edges based on qualified local mins
     std::vector<std::vector<mapping_igvc::Point2D>> split_edges;
+    size_t lastIndex = 0;
+    for (size_t splitIndex : splitIndices) {
+        split_edges.emplace_back(edge_points.begin() + lastIndex,
+                                 edge_points.begin() + splitIndex + 1);
+        lastIndex = splitIndex;
+    }
+    split_edges.emplace_back(edge_points.begin() + lastIndex,
+                             edge_points.end()); // Add last cluster of edges
+
+    return split_edges;
+}
 
-    std::vector<double> angles; // index 0 corresponds to index
-                                // min_points_in_cone of edge_points vector
+void ConeIdentification::findSplitIndices(PointSpan edge_points,
+                                          int min_points_in_cone,
+                                          double ang_threshold,
+                                          std::vector<double>& angles,
+                                          std::vector<size_t>& splitIndices) {
+    angles.clear();
+    splitIndices.clear();
+    if (edge_points.size() < min_points_in_cone * 2 + 1) return;
+
+    // index 0 of angles corresponds to index min_points_in_cone of edge_points
     for (int i = min_points_in_cone;
          i < edge_points.size() - min_points_in_cone;
          i++) {
@@ -162,10 +338,11 @@ double ang_threshold) {
 
     // Find local mins, then check if they are below threshold - if true, mark
     // as index to split at
-    std::vector<size_t> splitIndices;
-    for (int i = 1; i < angles.size() - 1; i++) {
+    for (int i = 1; i < (int) angles.size() - 1; i++) {
         bool isLocalMin = true;
-        for (int j = i - min_points_in_cone; j <= i + min_points_in_cone; j++) {
+        int first       = std::max(i - min_points_in_cone, 0);
+        int last = std::min(i + min_points_in_cone, (int) angles.size() - 1);
+        for (int j = first; j <= last; j++) {
             if (angles[j] < angles[i]) {
                 isLocalMin = false;
                 break;
@@ -174,26 +351,10 @@ double ang_threshold) {
         if (angles[i] < ang_threshold && isLocalMin)
             splitIndices.push_back(i + min_points_in_cone);
     }
-
-    // Split edges based on qualified local mins
-    size_t lastIndex = 0;
-    for (int i = 0; i < splitIndices.size(); i++) {
-        std::vector<mapping_igvc::Point2D> split(
-        edge_points.begin() + lastIndex,
-        edge_points.begin() + splitIndices[i] + 1);
-        split_edges.push_back(split);
-        lastIndex = splitIndices[i];
-    }
-    std::vector<mapping_igvc::Point2D> lastSplit(
-    edge_points.begin() + lastIndex,
-    edge_points.end()); // Add last cluster of edges
-    split_edges.push_back(lastSplit);
-
-    return split_edges;
 }
 
-mapping_igvc::ConeObstacle ConeIdentification::edgeToCone(
-const std::vector<mapping_igvc::Point2D>& edge_points) {
+mapping_igvc::ConeObstacle
+ConeIdentification::edgeToCone(PointSpan edge_points) {
     mapping_igvc::ConeObstacle cone = mapping_igvc::ConeObstacle();
 
     int i, iter, IterMAX = 99;
@@ -269,22 +430,19 @@ const std::vector<mapping_igvc::Point2D>& edge_points) {
     return cone;
 }
 
-double ConeIdentification::getMeanX(
-const std::vector<mapping_igvc::Point2D>& edge_points) {
+double ConeIdentification::getMeanX(PointSpan edge_points) {
     double tot_x = 0;
     for (int i = 0; i < edge_points.size(); i++) { tot_x += edge_points[i].x; }
     return tot_x / edge_points.size();
 }
 
-double ConeIdentification::getMeanY(
-const std::vector<mapping_igvc::Point2D>& edge_points) {
+double ConeIdentification::getMeanY(PointSpan edge_points) {
     double tot_y = 0;
     for (int i = 0; i < edge_points.size(); i++) { tot_y += edge_points[i].y; }
     return tot_y / edge_points.size();
 }
 
-double ConeIdentification::getRegressionSlope(
-const std::vector<mapping_igvc::Point2D>& edge_points) {
+double ConeIdentification::getRegressionSlope(PointSpan edge_points) {
     double meanX    = getMeanX(edge_points);
     double meanY    = getMeanY(edge_points);
     double sumNum   = 0;
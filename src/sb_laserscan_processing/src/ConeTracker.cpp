@@ -0,0 +1,226 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Implementation of ConeTracker, which follows the cones found
+ *              in previous scans
+ */
+
+#include <ConeTracker.h>
+#include <algorithm>
+#include <cmath>
+
+// Must be a power of two, so a hash can be turned into a bucket with a mask
+static const size_t NUM_BUCKETS = 64;
+
+// Gauss-Newton converges in a couple of steps from the previous center
+static const int NUM_REFIT_ITERATIONS = 3;
+
+ConeTracker::ConeTracker(double radius_exp,
+                         double radius_tol,
+                         double gate_distance,
+                         double process_noise,
+                         double measurement_noise,
+                         unsigned int min_hits,
+                         unsigned int max_missed_frames)
+  : radius_exp(radius_exp),
+    radius_tol(radius_tol),
+    gate_distance(gate_distance),
+    process_noise(process_noise),
+    measurement_noise(measurement_noise),
+    min_hits(min_hits),
+    max_missed_frames(max_missed_frames),
+    next_id(1),
+    // The mean of a cluster is up to a radius away from the cone's center,
+    // so this is the furthest a cluster is ever searched for from a track
+    cell_size(radius_exp + gate_distance),
+    buckets(NUM_BUCKETS) {}
+
+void ConeTracker::update(const std::vector<PointSpan>& edge_clusters) {
+    // Cones are assumed to stay put, so predicting a track only makes it
+    // less certain
+    for (ConeTrack& track : tracks) { track.variance += process_noise; }
+
+    buildGrid();
+    matched.assign(tracks.size(), false);
+
+    for (const PointSpan& edge_cluster : edge_clusters) {
+        // The edge points of a cone are all about a radius from its center,
+        // and so is their mean
+        double mean_x  = ConeIdentification::getMeanX(edge_cluster);
+        double mean_y  = ConeIdentification::getMeanY(edge_cluster);
+        size_t nearest = findNearestTrack(mean_x, mean_y, cell_size, true);
+
+        double x, y;
+        if (nearest < tracks.size() &&
+            refitFromTrack(edge_cluster, tracks[nearest], x, y)) {
+            correct(tracks[nearest], x, y);
+            matched[nearest] = true;
+            continue;
+        }
+
+        // No track explains the cluster, so fit a circle from scratch
+        mapping_igvc::ConeObstacle cone =
+        ConeIdentification::edgeToCone(edge_cluster);
+        if (fabs(cone.radius - radius_exp) > radius_tol) { continue; }
+
+        // A valid cone this close to a track is the same cone, even if the
+        // track already has a cluster this scan (one cone can yield several)
+        nearest =
+        findNearestTrack(cone.center.x, cone.center.y, gate_distance, false);
+        if (nearest < tracks.size()) {
+            correct(tracks[nearest], cone.center.x, cone.center.y);
+            matched[nearest] = true;
+            continue;
+        }
+
+        ConeTrack track;
+        track.id            = next_id++;
+        track.x             = cone.center.x;
+        track.y             = cone.center.y;
+        track.variance      = measurement_noise;
+        track.hits          = 0;
+        track.missed_frames = 0;
+        tracks.push_back(track);
+        matched.push_back(true);
+
+        // So that later clusters of the same cone find this track
+        addToGrid(tracks.size() - 1);
+    }
+
+    for (size_t i = 0; i < tracks.size(); i++) {
+        if (matched[i]) {
+            tracks[i].hits++;
+            tracks[i].missed_frames = 0;
+        } else {
+            tracks[i].missed_frames++;
+        }
+    }
+
+    tracks.erase(std::remove_if(tracks.begin(),
+                                tracks.end(),
+                                [this](const ConeTrack& track) {
+                                    return track.missed_frames >
+                                           max_missed_frames;
+                                }),
+                 tracks.end());
+}
+
+void ConeTracker::getCones(
+const std_msgs::Header& header,
+std::vector<mapping_igvc::ConeObstacle>& cones) const {
+    cones.clear();
+
+    for (const ConeTrack& track : tracks) {
+        if (track.hits < min_hits) { continue; }
+
+        mapping_igvc::ConeObstacle cone;
+        cone.header   = header;
+        cone.id       = track.id;
+        cone.center.x = track.x;
+        cone.center.y = track.y;
+        cone.radius   = radius_exp;
+        cones.push_back(cone);
+    }
+}
+
+bool ConeTracker::refitFromTrack(PointSpan edge_cluster,
+                                 const ConeTrack& track,
+                                 double& x,
+                                 double& y) const {
+    x = track.x;
+    y = track.y;
+
+    for (int iteration = 0; iteration < NUM_REFIT_ITERATIONS; iteration++) {
+        // Normal equations (sum of u * u^T) * step = sum of u * e, where u is
+        // the unit vector from the center to a point and e is how much
+        // further than the radius the point is
+        double uxx = 0, uxy = 0, uyy = 0;
+        double ex = 0, ey = 0;
+        for (const mapping_igvc::Point2D& point : edge_cluster) {
+            double dx   = point.x - x;
+            double dy   = point.y - y;
+            double dist = sqrt(dx * dx + dy * dy);
+            if (dist < 1e-9) { return false; }
+
+            double ux    = dx / dist;
+            double uy    = dy / dist;
+            double error = dist - radius_exp;
+            uxx += ux * ux;
+            uxy += ux * uy;
+            uyy += uy * uy;
+            ex += ux * error;
+            ey += uy * error;
+        }
+
+        // The points span too small an arc to pin down the center
+        double det = uxx * uyy - uxy * uxy;
+        if (det < 1e-6 * edge_cluster.size() * edge_cluster.size()) {
+            return false;
+        }
+
+        x += (uyy * ex - uxy * ey) / det;
+        y += (uxx * ey - uxy * ex) / det;
+    }
+
+    double total_error = 0;
+    for (const mapping_igvc::Point2D& point : edge_cluster) {
+        total_error += fabs(hypot(point.x - x, point.y - y) - radius_exp);
+    }
+
+    return total_error / edge_cluster.size() <= radius_tol &&
+           hypot(x - track.x, y - track.y) <= gate_distance;
+}
+
+size_t ConeTracker::findNearestTrack(double x,
+                                     double y,
+                                     double max_dist,
+                                     bool skip_matched) const {
+    long cell_x = (long) floor(x / cell_size);
+    long cell_y = (long) floor(y / cell_size);
+
+    size_t nearest       = tracks.size();
+    double nearest_dist2 = max_dist * max_dist;
+
+    // Anything within a cell size is in one of the 3x3 cells around (x, y)
+    for (long dx = -1; dx <= 1; dx++) {
+        for (long dy = -1; dy <= 1; dy++) {
+            for (size_t i : buckets[getBucket(cell_x + dx, cell_y + dy)]) {
+                if (skip_matched && matched[i]) { continue; }
+
+                double dist2 = (tracks[i].x - x) * (tracks[i].x - x) +
+                               (tracks[i].y - y) * (tracks[i].y - y);
+                if (dist2 <= nearest_dist2) {
+                    nearest       = i;
+                    nearest_dist2 = dist2;
+                }
+            }
+        }
+    }
+
+    return nearest;
+}
+
+void ConeTracker::correct(ConeTrack& track, double x, double y) const {
+    double gain = track.variance / (track.variance + measurement_noise);
+    track.x += gain * (x - track.x);
+    track.y += gain * (y - track.y);
+    track.variance *= 1 - gain;
+}
+
+void ConeTracker::buildGrid() {
+    // Clearing keeps each bucket's memory for the next scan
+    for (std::vector<size_t>& bucket : buckets) { bucket.clear(); }
+
+    for (size_t i = 0; i < tracks.size(); i++) { addToGrid(i); }
+}
+
+void ConeTracker::addToGrid(size_t index) {
+    long cell_x = (long) floor(tracks[index].x / cell_size);
+    long cell_y = (long) floor(tracks[index].y / cell_size);
+    buckets[getBucket(cell_x, cell_y)].push_back(index);
+}
+
+size_t ConeTracker::getBucket(long cell_x, long cell_y) const {
+    size_t hash = (size_t) cell_x * 73856093 ^ (size_t) cell_y * 19349663;
+    return hash & (NUM_BUCKETS - 1);
+}
@@ -0,0 +1,87 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Replays recorded LaserScans through cone identification and
+ *              prints the latency of each scan as a histogram, for the
+ *              sequential, parallel and tracking modes. Parameters are the
+ *              ones in cone_extractor.launch
+ *
+ * Usage: rosrun sb_laserscan_processing cone_identification_benchmark
+ *            <scans.bag|scans.dump> [repeats] [topic]
+ */
+
+#include <ConeIdentification.h>
+#include <ConeTracker.h>
+#include <LaserScanReplay.h>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace snowbots;
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr,
+                "Usage: %s <scans.bag|scans.dump> [repeats] [topic]\n",
+                argv[0]);
+        return 1;
+    }
+
+    unsigned int repeats = argc > 2 ? atoi(argv[2]) : 10;
+    std::string topic    = argc > 3 ? argv[3] : "";
+
+    std::vector<sensor_msgs::LaserScan> scans;
+    if (!loadLaserScans(argv[1], topic, scans) || scans.empty()) {
+        fprintf(stderr, "Could not load any scans from %s\n", argv[1]);
+        return 1;
+    }
+
+    // Cones are stamped with the current time, which needs no running ROS
+    ros::Time::init();
+
+    double dist_tol        = 0.08;
+    double radius_exp      = 0.3;
+    double radius_tol      = 0.05;
+    int min_points_in_cone = 3;
+    double ang_threshold   = 1.8;
+
+    ConeIdentification sequential_identifier(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold);
+    ConeIdentification parallel_identifier(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold, true);
+    ConeTracker tracker(radius_exp, radius_tol);
+    std::vector<mapping_igvc::ConeObstacle> cones;
+
+    size_t total_cones          = 0;
+    LatencyHistogram sequential = timeScans(
+    "identifyCones", scans, repeats, [&](const sensor_msgs::LaserScan& scan) {
+        sequential_identifier.identifyCones(scan, cones);
+        total_cones += cones.size();
+    });
+
+    LatencyHistogram parallel =
+    timeScans("identifyCones (parallel)",
+              scans,
+              repeats,
+              [&](const sensor_msgs::LaserScan& scan) {
+                  parallel_identifier.identifyCones(scan, cones);
+              });
+
+    LatencyHistogram tracking =
+    timeScans("findEdgeClusters + ConeTracker::update",
+              scans,
+              repeats,
+              [&](const sensor_msgs::LaserScan& scan) {
+                  tracker.update(sequential_identifier.findEdgeClusters(scan));
+                  tracker.getCones(scan.header, cones);
+              });
+
+    printf("%zu scans of %zu beams, %.2f cones per scan\n\n",
+           scans.size(),
+           scans[0].ranges.size(),
+           (double) total_cones / ((repeats + 1) * scans.size()));
+    sequential.print();
+    parallel.print();
+    tracking.print();
+
+    return 0;
+}
@@ -474,6 +474,128 @@ TEST(ConeIdentification, twoConesDiagonal) {
     EXPECT_NEAR(cones[1].center.y, 1, 0.05);
 }
 
+// Test that a reused ConeIdentification finds the same cones as the static
+// version, for scans with different numbers of beams
+TEST(ConeIdentification, reusedAcrossScansOfDifferentSizes) {
+    float dist_tol         = 0.1;
+    float radius_exp       = 1.0;
+    float radius_tol       = 0.15;
+    int min_points_in_cone = 5;
+    double ang_threshold   = 2.3;
+
+    LaserscanBuilder::LaserscanBuilder builder;
+    builder.addCone(3.5, 0, 1); // x y radius
+    builder.addCone(2, -1.3, 1);
+    builder.addCone(2, 1.3, 1);
+    sensor_msgs::LaserScan large_scan = builder.getLaserscan();
+    large_scan.header.frame_id        = "laser";
+
+    // Every other beam of the same scan, as from a lidar at a lower
+    // resolution
+    sensor_msgs::LaserScan small_scan = large_scan;
+    small_scan.angle_increment *= 2;
+    small_scan.ranges.clear();
+    for (int i = 0; i < large_scan.ranges.size(); i += 2) {
+        small_scan.ranges.push_back(large_scan.ranges[i]);
+    }
+
+    ConeIdentification cone_identifier(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold);
+    std::vector<mapping_igvc::ConeObstacle> cones;
+
+    for (const sensor_msgs::LaserScan& scan :
+         {large_scan, small_scan, large_scan, small_scan}) {
+        std::vector<mapping_igvc::ConeObstacle> expected_cones =
+        ConeIdentification::identifyCones(scan,
+                                          dist_tol,
+                                          radius_exp,
+                                          radius_tol,
+                                          min_points_in_cone,
+                                          ang_threshold);
+        cone_identifier.identifyCones(scan, cones);
+
+        ASSERT_EQ(3, expected_cones.size());
+        ASSERT_EQ(expected_cones.size(), cones.size());
+        for (int i = 0; i < cones.size(); i++) {
+            EXPECT_DOUBLE_EQ(expected_cones[i].center.x, cones[i].center.x);
+            EXPECT_DOUBLE_EQ(expected_cones[i].center.y, cones[i].center.y);
+            EXPECT_DOUBLE_EQ(expected_cones[i].radius, cones[i].radius);
+            EXPECT_EQ("laser", cones[i].header.frame_id);
+        }
+    }
+}
+
+// Test that splitting an edge cluster copies out the same points as the split
+// indices point to, with neighbouring splits sharing their split point
+TEST(ConeIdentification, splitEdgeMatchesSplitIndices) {
+    LaserscanBuilder::LaserscanBuilder builder;
+    builder.addCone(3, 1, 1); // x y radius
+    builder.addCone(3, -1, 1);
+    sensor_msgs::LaserScan laser_msg = builder.getLaserscan();
+
+    std::vector<mapping_igvc::Point2D> edge_points;
+    for (int i = 0; i < laser_msg.ranges.size(); i++) {
+        if (laser_msg.ranges[i] <= laser_msg.range_max) {
+            edge_points.push_back(ConeIdentification::laserToPoint(
+            laser_msg.ranges[i],
+            laser_msg.angle_min + i * laser_msg.angle_increment));
+        }
+    }
+
+    std::vector<double> angles;
+    std::vector<size_t> split_indices;
+    ConeIdentification::findSplitIndices(
+    edge_points, 5, 2.3, angles, split_indices);
+    std::vector<std::vector<mapping_igvc::Point2D>> split_edges =
+    ConeIdentification::splitEdge(edge_points, 5, 2.3);
+
+    ASSERT_EQ(1, split_indices.size());
+    ASSERT_EQ(2, split_edges.size());
+    EXPECT_EQ(split_indices[0] + 1, split_edges[0].size());
+    EXPECT_EQ(edge_points.size() - split_indices[0], split_edges[1].size());
+    EXPECT_DOUBLE_EQ(split_edges[0].back().x, split_edges[1].front().x);
+    EXPECT_DOUBLE_EQ(split_edges[0].back().y, split_edges[1].front().y);
+}
+
+// The parallel mode finds the same cones in the same order as the sequential
+// mode
+TEST(ConeIdentification, parallelMatchesSequential) {
+    float dist_tol         = 0.1;
+    float radius_exp       = 0.5;
+    float radius_tol       = 0.2;
+    int min_points_in_cone = 5;
+    double ang_threshold   = 2.3;
+
+    LaserscanBuilder::LaserscanBuilder builder;
+    builder.addCone(2, -3, 0.5); // x y radius
+    builder.addCone(2, -1.5, 0.5);
+    builder.addCone(3, 0, 0.5);
+    builder.addCone(1.5, 1.5, 0.5);
+    builder.addCone(1, 3, 0.5);
+    sensor_msgs::LaserScan laser_msg = builder.getLaserscan();
+
+    ConeIdentification sequential_identifier(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold);
+    ConeIdentification parallel_identifier(
+    dist_tol, radius_exp, radius_tol, min_points_in_cone, ang_threshold, true);
+    std::vector<mapping_igvc::ConeObstacle> sequential_cones;
+    std::vector<mapping_igvc::ConeObstacle> parallel_cones;
+
+    for (int scan = 0; scan < 3; scan++) {
+        sequential_identifier.identifyCones(laser_msg, sequential_cones);
+        parallel_identifier.identifyCones(laser_msg, parallel_cones);
+
+        ASSERT_EQ(5, sequential_cones.size());
+        ASSERT_EQ(sequential_cones.size(), parallel_cones.size());
+        for (int i = 0; i < parallel_cones.size(); i++) {
+            EXPECT_DOUBLE_EQ(sequential_cones[i].center.x,
+                             parallel_cones[i].center.x);
+            EXPECT_DOUBLE_EQ(sequential_cones[i].center.y,
+                             parallel_cones[i].center.y);
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     ros::Time::init();
     testing::InitGoogleTest(&argc, argv);
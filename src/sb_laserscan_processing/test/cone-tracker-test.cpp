@@ -0,0 +1,153 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: GTest for ConeTracker
+ */
+
+#include "./LaserscanBuilder.h"
+#include <ConeIdentification.h>
+#include <ConeTracker.h>
+#include <gtest/gtest.h>
+
+class ConeTrackerTest : public testing::Test {
+  protected:
+    ConeTrackerTest()
+      : identifier(dist_tol, radius_exp, radius_tol, min_points_in_cone, 2.3),
+        tracker(radius_exp, radius_tol, 0.3, 0.01, 0.01, 2, 2) {}
+
+    // Runs the tracker on a scan of the given cones, given as x, y pairs
+    void addScan(const std::vector<std::pair<double, double>>& cone_centers) {
+        LaserscanBuilder::LaserscanBuilder builder;
+        for (const std::pair<double, double>& center : cone_centers) {
+            builder.addCone(center.first, center.second, radius_exp);
+        }
+        sensor_msgs::LaserScan laser_msg = builder.getLaserscan();
+        tracker.update(identifier.findEdgeClusters(laser_msg));
+    }
+
+    std::vector<mapping_igvc::ConeObstacle> getCones() {
+        std::vector<mapping_igvc::ConeObstacle> cones;
+        tracker.getCones(std_msgs::Header(), cones);
+        return cones;
+    }
+
+    const double dist_tol        = 0.05;
+    const double radius_exp      = 1.0;
+    const double radius_tol      = 0.05;
+    const int min_points_in_cone = 5;
+
+    ConeIdentification identifier;
+    ConeTracker tracker;
+};
+
+// A cone is only reported once it has been seen in min_hits scans
+TEST_F(ConeTrackerTest, coneConfirmedAfterMinHits) {
+    addScan({{3, 0}});
+    EXPECT_EQ(1, tracker.getTracks().size());
+    EXPECT_TRUE(getCones().empty());
+
+    addScan({{3, 0}});
+    std::vector<mapping_igvc::ConeObstacle> cones = getCones();
+    ASSERT_EQ(1, cones.size());
+    EXPECT_NEAR(3, cones[0].center.x, 0.05);
+    EXPECT_NEAR(0, cones[0].center.y, 0.05);
+    EXPECT_DOUBLE_EQ(radius_exp, cones[0].radius);
+    EXPECT_NE(0, cones[0].id);
+}
+
+// Each cone keeps its id from scan to scan
+TEST_F(ConeTrackerTest, idsStableAcrossScans) {
+    addScan({{3, 3}, {3, -3}});
+    addScan({{3, 3}, {3, -3}});
+    std::vector<mapping_igvc::ConeObstacle> first = getCones();
+    ASSERT_EQ(2, first.size());
+    EXPECT_NE(first[0].id, first[1].id);
+
+    addScan({{3, 3}, {3, -3}});
+    std::vector<mapping_igvc::ConeObstacle> second = getCones();
+    ASSERT_EQ(2, second.size());
+    EXPECT_EQ(first[0].id, second[0].id);
+    EXPECT_EQ(first[1].id, second[1].id);
+    EXPECT_EQ(2, tracker.getTracks().size());
+}
+
+// A cone missing from a few scans is still reported, until it has been
+// missing for more than max_missed_frames scans
+TEST_F(ConeTrackerTest, coneCoastsThroughMissedScans) {
+    addScan({{3, 0}});
+    addScan({{3, 0}});
+    unsigned int id = getCones()[0].id;
+
+    addScan({});
+    addScan({});
+    std::vector<mapping_igvc::ConeObstacle> cones = getCones();
+    ASSERT_EQ(1, cones.size());
+    EXPECT_EQ(id, cones[0].id);
+
+    addScan({{3, 0}});
+    cones = getCones();
+    ASSERT_EQ(1, cones.size());
+    EXPECT_EQ(id, cones[0].id);
+
+    addScan({});
+    addScan({});
+    addScan({});
+    EXPECT_TRUE(getCones().empty());
+    EXPECT_TRUE(tracker.getTracks().empty());
+}
+
+// A slowly moving cone is followed by the same track
+TEST_F(ConeTrackerTest, followsMovingCone) {
+    addScan({{3, 0}});
+    addScan({{3, 0}});
+    unsigned int id = getCones()[0].id;
+
+    for (int i = 1; i <= 5; i++) { addScan({{3, 0.1 * i}}); }
+
+    std::vector<mapping_igvc::ConeObstacle> cones = getCones();
+    ASSERT_EQ(1, cones.size());
+    EXPECT_EQ(id, cones[0].id);
+    EXPECT_NEAR(3, cones[0].center.x, 0.05);
+    EXPECT_NEAR(0.5, cones[0].center.y, 0.1);
+}
+
+// A cone that jumps further than the gate starts a new track
+TEST_F(ConeTrackerTest, farConeStartsNewTrack) {
+    addScan({{3, 0}});
+    addScan({{3, 0}});
+    unsigned int id = getCones()[0].id;
+
+    addScan({{3, 2}});
+    ASSERT_EQ(2, tracker.getTracks().size());
+    EXPECT_NE(id, tracker.getTracks()[1].id);
+}
+
+// Two edge clusters of the same cone in one scan give only one track
+TEST_F(ConeTrackerTest, twoClustersOfOneConeInOneScan) {
+    LaserscanBuilder::LaserscanBuilder builder;
+    builder.addCone(3, 0, radius_exp);
+    sensor_msgs::LaserScan laser_msg = builder.getLaserscan();
+    std::vector<PointSpan> clusters  = identifier.findEdgeClusters(laser_msg);
+    ASSERT_EQ(1, clusters.size());
+
+    // Split the edge of the cone in two, as if a beam in the middle dropped
+    size_t half                           = clusters[0].size() / 2;
+    std::vector<PointSpan> split_clusters = {
+    clusters[0].subspan(0, half),
+    clusters[0].subspan(half, clusters[0].size() - half)};
+
+    // Without any track yet, and again once the cone is tracked
+    for (int scan = 0; scan < 2; scan++) {
+        tracker.update(split_clusters);
+        ASSERT_EQ(1, tracker.getTracks().size());
+        EXPECT_EQ(scan + 1, tracker.getTracks()[0].hits);
+        EXPECT_NEAR(3, tracker.getTracks()[0].x, 0.05);
+        EXPECT_NEAR(0, tracker.getTracks()[0].y, 0.05);
+    }
+}
+
+int main(int argc, char** argv) {
+    ros::Time::init();
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Ros tests for the Cone Extractor Node
+ */
+
+#include "./LaserscanBuilder.h"
+#include <gtest/gtest.h>
+#include <mapping_igvc/ConeObstacleArray.h>
+
+/**
+ * Publishes scans to the node, and keeps every cone array it publishes
+ */
+class ConeExtractorRosTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        test_publisher =
+        nh_.advertise<sensor_msgs::LaserScan>("/robot/laser/scan", 1);
+        test_array_subscriber =
+        nh_.subscribe("/cone_extractor_node/output_cone_obstacles",
+                      10,
+                      &ConeExtractorRosTest::arrayCallback,
+                      this);
+
+        // Let the publishers and subscribers set itself up timely
+        ros::Rate loop_rate(1);
+        loop_rate.sleep();
+    }
+
+    /**
+     * Publishes a scan and waits for the node to process it
+     */
+    void publishScan(const sensor_msgs::LaserScan& scan) {
+        test_publisher.publish(scan);
+
+        // Wait for the message to get passed around
+        ros::Rate loop_rate(1);
+        loop_rate.sleep();
+        ros::spinOnce();
+    }
+
+    ros::NodeHandle nh_;
+    std::vector<mapping_igvc::ConeObstacleArray> coneArrays;
+    ros::Publisher test_publisher;
+    ros::Subscriber test_array_subscriber;
+
+  public:
+    void arrayCallback(const mapping_igvc::ConeObstacleArray& cones) {
+        coneArrays.push_back(cones);
+    }
+};
+
+TEST_F(ConeExtractorRosTest, OneArrayPerScanWithAllItsCones) {
+    LaserscanBuilder::LaserscanBuilder builder;
+    builder.addCone(3, 3, 1); // x y radius
+    builder.addCone(3, -3, 1);
+    sensor_msgs::LaserScan scan = builder.getLaserscan();
+    scan.header.frame_id        = "laser";
+
+    scan.header.seq   = 1;
+    scan.header.stamp = ros::Time(10, 0);
+    publishScan(scan);
+
+    scan.header.seq   = 2;
+    scan.header.stamp = ros::Time(11, 0);
+    publishScan(scan);
+
+    ASSERT_EQ(2, coneArrays.size());
+    for (unsigned int i = 0; i < coneArrays.size(); i++) {
+        const mapping_igvc::ConeObstacleArray& cones = coneArrays[i];
+
+        // The header is the one of the scan the cones were found in
+        EXPECT_EQ("laser", cones.header.frame_id);
+        EXPECT_EQ(ros::Time(10 + i, 0), cones.header.stamp);
+
+        ASSERT_EQ(2, cones.obstacles.size());
+        EXPECT_NEAR(1.0, cones.obstacles[0].radius, 0.01);
+        EXPECT_NEAR(3.0, cones.obstacles[0].center.x, 0.01);
+        EXPECT_NEAR(-3.0, cones.obstacles[0].center.y, 0.01);
+        EXPECT_NEAR(1.0, cones.obstacles[1].radius, 0.01);
+        EXPECT_NEAR(3.0, cones.obstacles[1].center.x, 0.01);
+        EXPECT_NEAR(3.0, cones.obstacles[1].center.y, 0.01);
+    }
+}
+
+TEST_F(ConeExtractorRosTest, EmptyScanStillGetsAnArray) {
+    LaserscanBuilder::LaserscanBuilder builder;
+    sensor_msgs::LaserScan scan = builder.getLaserscan();
+    scan.header.stamp           = ros::Time(12, 0);
+    publishScan(scan);
+
+    ASSERT_EQ(1, coneArrays.size());
+    EXPECT_EQ(ros::Time(12, 0), coneArrays[0].header.stamp);
+    EXPECT_EQ(0, coneArrays[0].obstacles.size());
+}
+
+int main(int argc, char** argv) {
+    // !! Don't forget to initialize ROS, since this is a test within the ros
+    // framework !!
+    ros::init(argc, argv, "cone_extractor_rostest");
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,121 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A class which finds the ground plane in a pointcloud and
+ *              splits the cloud into ground and non-ground points.
+ *              Used in the ground_segmentation nodelet.
+ */
+
+#ifndef SB_POINTCLOUD_PROCESSING_GROUND_PLANE_SEGMENTER_H
+#define SB_POINTCLOUD_PROCESSING_GROUND_PLANE_SEGMENTER_H
+
+#include <Eigen/Dense>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <random>
+
+class GroundPlaneSegmenter {
+  public:
+    /**
+     * @param distance_threshold maximum distance of a point from the plane
+     *        for it to be considered part of the ground
+     * @param max_iterations maximum number of RANSAC iterations
+     * @param up_axis the direction that is roughly "up" in the frame of the
+     *        cloud
+     * @param max_angle maximum angle (rad) between the plane normal and
+     *        @up_axis, so that walls are never mistaken for the ground
+     * @param min_inlier_ratio minimum fraction of points the previous plane
+     *        must explain to be reused without running RANSAC
+     * @param max_scored_points maximum number of points used to score a
+     *        candidate plane, evenly picked from the cloud
+     */
+    GroundPlaneSegmenter(float distance_threshold    = 0.05,
+                         unsigned int max_iterations = 100,
+                         Eigen::Vector3f up_axis     = Eigen::Vector3f(0, 0, 1),
+                         float max_angle             = 0.5,
+                         float min_inlier_ratio      = 0.3,
+                         unsigned int max_scored_points = 2000);
+
+    /**
+     * Finds the ground plane of the cloud and splits the cloud by it
+     *
+     * The plane found in the previous cloud is tried first, refined by least
+     * squares over its inliers; RANSAC is only run if it no longer explains
+     * enough of the cloud.
+     *
+     * @param input the cloud to segment
+     * @param ground set to the points within the distance threshold of the
+     *        ground plane
+     * @param non_ground set to all other points
+     * @return false if no ground plane could be found, in which case every
+     *         point is put in @non_ground
+     */
+    bool segment(const pcl::PointCloud<pcl::PointXYZRGB>& input,
+                 pcl::PointCloud<pcl::PointXYZRGB>& ground,
+                 pcl::PointCloud<pcl::PointXYZRGB>& non_ground);
+
+    /**
+     * Whether a plane has been found in a previous cloud
+     */
+    bool hasPlane() const { return has_plane; }
+
+    /**
+     * The last plane found, as (a, b, c, d) with a*x + b*y + c*z + d = 0 and
+     * the normal (a, b, c) of unit length, pointing along the up axis
+     */
+    const Eigen::Vector4f& getPlane() const { return plane; }
+
+    /**
+     * Forgets the previous plane, so the next cloud runs RANSAC
+     */
+    void reset() { has_plane = false; }
+
+  private:
+    /**
+     * Picks at most @max_scored_points evenly spaced points of the cloud
+     * into the first @num_sampled columns of @sampled_points
+     */
+    void samplePoints(const pcl::PointCloud<pcl::PointXYZRGB>& input);
+
+    /**
+     * Runs RANSAC over the given points
+     * @return true if a plane was found
+     */
+    bool ransacPlane(const Eigen::Ref<const Eigen::Matrix3Xf>& points,
+                     Eigen::Vector4f& result);
+
+    /**
+     * Fits a plane by least squares through the given points within the
+     * distance threshold of @estimate
+     * @return the fraction of the points that were inliers
+     */
+    float refinePlane(const Eigen::Ref<const Eigen::Matrix3Xf>& points,
+                      Eigen::Vector4f& estimate) const;
+
+    /**
+     * Flips the plane to point along the up axis, and checks that it is
+     * not tilted too far from it
+     * @return true if the plane could be the ground
+     */
+    bool orientPlane(Eigen::Vector4f& candidate) const;
+
+    float distance_threshold;
+    unsigned int max_iterations;
+    Eigen::Vector3f up_axis;
+    float cos_max_angle;
+    float min_inlier_ratio;
+    unsigned int max_scored_points;
+
+    bool has_plane;
+    Eigen::Vector4f plane;
+
+    std::mt19937 generator;
+
+    // The points used to fit the plane, one per column. Sized once for the
+    // most points that can be sampled, so only the first @num_sampled
+    // columns hold points from the current cloud
+    Eigen::Matrix3Xf sampled_points;
+    unsigned int num_sampled;
+};
+
+#endif // SB_POINTCLOUD_PROCESSING_GROUND_PLANE_SEGMENTER_H
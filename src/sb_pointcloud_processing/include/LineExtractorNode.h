@@ -8,10 +8,13 @@
 #define LINE_EXTRACTOR_IGVC_NODE_H
 
 #include "DBSCAN.h"
+#include "LineTracker.h"
+#include "RansacRegression.h"
 #include "Regression.h"
 #include <RvizUtils.h>
 #include <iostream>
 #include <mapping_igvc/LineObstacle.h>
+#include <mapping_igvc/LineObstacleArray.h>
 #include <math.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
@@ -51,6 +54,7 @@ class LineExtractorNode {
   private:
     ros::Subscriber subscriber;
     ros::Publisher publisher;
+    ros::Publisher array_publisher;
     ros::Publisher rviz_line_publisher;
     ros::Publisher rviz_cluster_publisher;
 
@@ -62,6 +66,26 @@ class LineExtractorNode {
      */
     Regression regression;
 
+    /*
+     * @ransac is used instead of @regression when @useRansac is set, and
+     * fits lines that are robust to outlier points within a cluster
+     */
+    RansacRegression ransac;
+
+    /*
+     * @useRansac selects whether lines are fitted with @ransac (true) or with
+     * plain least squares by @regression (false)
+     */
+    bool useRansac;
+
+    /*
+     * @tracker remembers the lines from previous pointclouds. When
+     * @useTracking is set, points near a tracked line are used to refit it,
+     * and only the remaining points are clustered to look for new lines.
+     */
+    LineTracker tracker;
+    bool useTracking;
+
     /*
      * @degreePoly is a hyperparameter to regression that determines
      * the degree of polynomial of the line of best fit
@@ -141,8 +165,16 @@ class LineExtractorNode {
     std::vector<geometry_msgs::Point> convertLineObstaclesToPoints(
     std::vector<mapping_igvc::LineObstacle> line_obstacles);
 
+    /*
+     * Fits a line to each cluster with either @ransac or @regression,
+     * depending on @useRansac
+     */
+    std::vector<Eigen::VectorXf>
+    fitLines(const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters);
+
     /*
      * Convert a list of vectors to a list of LineObstacle message
+     * Each message is built independently, so this runs in parallel
      */
     std::vector<mapping_igvc::LineObstacle>
     vectorsToMsgs(std::vector<Eigen::VectorXf> vectors);
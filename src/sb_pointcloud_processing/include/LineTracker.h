@@ -0,0 +1,160 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Class declaration for LineTracker, which keeps track of the
+ *              lines found in previous pointclouds so that they can be
+ *              updated cheaply and keep the same identity across frames
+ */
+
+#ifndef LINE_EXTRACTOR_IGVC_LINETRACKER_H
+#define LINE_EXTRACTOR_IGVC_LINETRACKER_H
+
+#include "MomentAccumulator.h"
+#include "RansacRegression.h"
+#include <Eigen/Dense>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <vector>
+
+/*
+ * A line that has been seen in one or more pointclouds
+ */
+struct LineTrack {
+    // Identifier that stays the same for as long as the line is tracked
+    unsigned int id;
+
+    // Coefficients of the line, where the index of a coefficient corresponds
+    // to its degree
+    Eigen::VectorXf coefficients;
+
+    // The domain of the line
+    float x_min;
+    float x_max;
+
+    // Number of consecutive pointclouds in which the line was not seen
+    unsigned int missed_frames;
+};
+
+class LineTracker {
+  public:
+    /*
+     * Constructor:
+     * @corridor_width: how far (vertically, and past either end of the line)
+     * a point may be from a tracked line to be assigned to it
+     * @max_missed_frames: a track is dropped once it has not been seen for
+     * more than this many consecutive pointclouds
+     * @min_points: minimum number of points a track needs in a pointcloud to
+     * count as seen
+     * @prior_weight: how strongly refits are pulled towards the previous
+     * coefficients of the track
+     */
+    LineTracker(float corridor_width           = 0.1,
+                unsigned int max_missed_frames = 3,
+                unsigned int min_points        = 3,
+                float prior_weight             = 10);
+
+    /*
+     * Refits tracks with @ransac instead of plain least squares, so that the
+     * same fitter is used for new and tracked lines
+     */
+    void setRansac(const RansacRegression& ransac);
+
+    /*
+     * Assigns every point in @cloud that lies within the corridor of a
+     * tracked line to the closest such line, and returns all points that
+     * were not assigned to any line
+     * Only the returned points need to be clustered to find new lines.
+     */
+    pcl::PointCloud<pcl::PointXYZ>
+    assignPoints(const pcl::PointCloud<pcl::PointXYZ>& cloud);
+
+    /*
+     * Refits every track that was assigned at least @min_points points,
+     * warm started from its previous coefficients, and ages out the tracks
+     * that were not seen
+     * Tracks that have converged onto the same line are then merged into the
+     * oldest of them.
+     * @lambda: Regularization parameter added on top of the prior weight
+     */
+    void updateTracks(float lambda = 0);
+
+    /*
+     * Starts a new track for each cluster and its line of best fit
+     * The new tracks count as seen in the current pointcloud.
+     */
+    void addTracks(const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+                   const std::vector<Eigen::VectorXf>& lines);
+
+    /*
+     * Gets the clusters, lines and ids of all tracks that were seen in the
+     * current pointcloud, with matching indices
+     */
+    void getSeenTracks(std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+                       std::vector<Eigen::VectorXf>& lines,
+                       std::vector<unsigned int>& ids) const;
+
+    /*
+     * Returns all tracks, including the ones not seen in the current
+     * pointcloud
+     */
+    const std::vector<LineTrack>& getTracks() const { return tracks; }
+
+    /*
+     * Drops all tracks
+     */
+    void clear();
+
+  private:
+    /*
+     * Evaluates the polynomial @line at @x using Horner's method
+     */
+    static float evaluate(const Eigen::VectorXf& line, float x);
+
+    /*
+     * Sets the domain of @track to the x range of @cluster
+     */
+    static void setDomain(LineTrack& track,
+                          const pcl::PointCloud<pcl::PointXYZ>& cluster);
+
+    /*
+     * Refits @track to @cluster, pulling it towards its previous coefficients
+     */
+    void refit(LineTrack& track,
+               const pcl::PointCloud<pcl::PointXYZ>& cluster,
+               float lambda);
+
+    /*
+     * Checks if two tracks follow the same line, ie. their domains overlap
+     * and they are within the corridor of each other at both ends and the
+     * middle of the overlap
+     */
+    bool isSameLine(const LineTrack& first, const LineTrack& second) const;
+
+    /*
+     * Merges every track into the oldest track that follows the same line
+     */
+    void mergeTracks(float lambda);
+
+    float corridor_width;
+    unsigned int max_missed_frames;
+    unsigned int min_points;
+    float prior_weight;
+
+    unsigned int next_id;
+
+    /*
+     * Tracks are refit with @ransac when @use_ransac is set
+     */
+    bool use_ransac;
+    RansacRegression ransac;
+
+    std::vector<LineTrack> tracks;
+
+    /*
+     * The points assigned to each track in the current pointcloud, with the
+     * same indices as @tracks
+     */
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> track_clusters;
+};
+
+#endif // LINE_EXTRACTOR_IGVC_LINETRACKER_H
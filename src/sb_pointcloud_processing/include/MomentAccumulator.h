@@ -0,0 +1,114 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Class declaration for MomentAccumulator, which incrementally
+ *              accumulates the normal equations of a polynomial least squares
+ *              fit so that a line of best fit can be solved for without
+ *              building the full design matrix
+ */
+
+#ifndef LINE_EXTRACTOR_IGVC_MOMENTACCUMULATOR_H
+#define LINE_EXTRACTOR_IGVC_MOMENTACCUMULATOR_H
+
+#include <Eigen/Dense>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+class MomentAccumulator {
+  public:
+    /*
+     * Constructor:
+     * Takes in the degree of polynomial of the line to be fitted
+     */
+    explicit MomentAccumulator(unsigned int poly_degree = 1);
+
+    /*
+     * Adds a single point to the fit in O(poly_degree)
+     */
+    void addPoint(float x, float y);
+
+    /*
+     * Removes a single point that was previously added to the fit in
+     * O(poly_degree)
+     */
+    void removePoint(float x, float y);
+
+    /*
+     * Adds every point of the given cluster to the fit
+     */
+    void addCluster(const pcl::PointCloud<pcl::PointXYZ>& cluster);
+
+    /*
+     * Removes every point of the given cluster from the fit
+     */
+    void removeCluster(const pcl::PointCloud<pcl::PointXYZ>& cluster);
+
+    /*
+     * Removes all points from the fit, keeping the polynomial degree
+     */
+    void clear();
+
+    /*
+     * Returns the number of points currently in the fit
+     */
+    unsigned int getNumPoints() const { return num_points; }
+
+    /*
+     * Returns the degree of polynomial of the line being fitted
+     */
+    unsigned int getPolyDegree() const { return poly_degree; }
+
+    /*
+     * Returns the (d+1)x(d+1) moment matrix X' * X, where d is the degree of
+     * polynomial
+     */
+    Eigen::MatrixXd getMomentMatrix() const;
+
+    /*
+     * Returns the (d+1) moment vector X' * y, where d is the degree of
+     * polynomial
+     */
+    Eigen::VectorXd getMomentVector() const { return xy_power_sums; }
+
+    /*
+     * Solves (X' * X + lambda * I) * w = X' * y for the coefficients w of the
+     * line of best fit, where the index of a coefficient corresponds to its
+     * degree
+     * @lambda: Regularization parameter (Default: 0)
+     */
+    Eigen::VectorXf solve(float lambda = 0) const;
+
+    /*
+     * Solves (X' * X + lambda * I) * w = X' * y + lambda * prior, which pulls
+     * the coefficients towards @prior rather than towards zero
+     * Used to warm start a fit from a previous estimate of the same line.
+     * If @prior does not have d+1 coefficients this is the same as solve().
+     */
+    Eigen::VectorXf solveWithPrior(float lambda,
+                                   const Eigen::VectorXf& prior) const;
+
+  private:
+    /*
+     * Adds (sign = 1) or removes (sign = -1) the contribution of a point
+     */
+    void accumulate(float x, float y, double sign);
+
+    unsigned int poly_degree;
+
+    unsigned int num_points;
+
+    /*
+     * The k-th entry stores the sum of x^k over all points, for k in [0, 2d].
+     * The moment matrix is a Hankel matrix, so entry (i, j) is simply the
+     * (i + j)-th power sum.
+     */
+    Eigen::VectorXd x_power_sums;
+
+    /*
+     * The k-th entry stores the sum of y * x^k over all points, for k in
+     * [0, d]
+     */
+    Eigen::VectorXd xy_power_sums;
+};
+
+#endif // LINE_EXTRACTOR_IGVC_MOMENTACCUMULATOR_H
@@ -0,0 +1,142 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Class declaration for RansacRegression, which calculates a
+ *              line of best fit for each cluster of points while ignoring
+ *              outliers (MSAC variant of RANSAC)
+ */
+
+#ifndef LINE_EXTRACTOR_IGVC_RANSACREGRESSION_H
+#define LINE_EXTRACTOR_IGVC_RANSACREGRESSION_H
+
+#include "MomentAccumulator.h"
+#include <Eigen/Dense>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <random>
+#include <vector>
+
+class RansacRegression {
+  public:
+    /*
+     * Constructor:
+     * @max_iterations: upper bound on the number of random samples tried per
+     * cluster
+     * @inlier_threshold: maximum vertical distance from a line for a point to
+     * count as an inlier
+     * @confidence: probability of having drawn at least one outlier free
+     * sample before terminating early
+     * @seed: seed for the random sampler, so fits are reproducible
+     */
+    RansacRegression(unsigned int max_iterations = 100,
+                     float inlier_threshold      = 0.1,
+                     float confidence            = 0.99,
+                     unsigned int seed           = 123);
+
+    /*
+     * Returns a std::vector of Eigen::VectorXf
+     * Each Eigen::VectorXf corresponds to the line of best fit of a
+     * PointCloud<PointXYZ> cluster
+     * The corresponding vector and cluster have the same index within each of
+     * their vectors.
+     * Clusters are fitted in parallel, and each cluster is sampled with its
+     * own seed so the result does not depend on thread scheduling.
+     * @poly_degree: Degree of polynomial of the line of best fit
+     * @lambda: Regularization parameter for the final refit (Default: 0)
+     */
+    std::vector<Eigen::VectorXf> getLinesOfBestFit(
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+    unsigned int poly_degree,
+    float lambda = 0) const;
+
+    /*
+     * Returns the line of best fit of a single cluster
+     * The best minimal sample model is found by MSAC, and the line is then
+     * refitted by least squares over that model's inliers.
+     * Falls back to plain least squares if the cluster is too small to sample.
+     */
+    Eigen::VectorXf fit(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                        unsigned int poly_degree,
+                        float lambda = 0);
+
+    /*
+     * Same as fit(), but the final refit over the inliers pulls the
+     * coefficients towards @prior rather than towards zero
+     * (see MomentAccumulator::solveWithPrior)
+     */
+    Eigen::VectorXf fitWithPrior(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                                 unsigned int poly_degree,
+                                 float lambda,
+                                 const Eigen::VectorXf& prior);
+
+    /*
+     * Reseeds the random sampler
+     */
+    void setSeed(unsigned int seed);
+
+    void setMaxIterations(unsigned int max_iterations);
+    void setInlierThreshold(float inlier_threshold);
+    void setConfidence(float confidence);
+
+  private:
+    /*
+     * Finds the best minimal sample model of @cluster by MSAC, and adds its
+     * inliers to @inliers (or the whole cluster if it is too small to sample
+     * or no good model was found)
+     */
+    void findInliers(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                     unsigned int poly_degree);
+
+    /*
+     * Fills @sample_indices with poly_degree + 1 distinct random indices into
+     * a cluster of size @num_points
+     */
+    void drawSample(unsigned int num_points);
+
+    /*
+     * Solves for the polynomial passing exactly through the sampled points,
+     * storing it in @candidate
+     * Returns false if the sample is degenerate (eg. repeated x values)
+     */
+    bool fitSample(const pcl::PointCloud<pcl::PointXYZ>& cluster);
+
+    /*
+     * Returns the MSAC cost of @line over the cluster, which is the sum of
+     * squared residuals with each residual capped at the inlier threshold
+     * @num_inliers: set to the number of points within the threshold
+     */
+    float scoreLine(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                    const Eigen::VectorXf& line,
+                    unsigned int& num_inliers) const;
+
+    /*
+     * Evaluates the polynomial @line at @x using Horner's method
+     */
+    static float evaluate(const Eigen::VectorXf& line, float x);
+
+    /*
+     * Resizes the sample buffers if the degree of polynomial has changed
+     */
+    void reserveBuffers(unsigned int poly_degree);
+
+    unsigned int max_iterations;
+    float inlier_threshold;
+    float confidence;
+    unsigned int seed;
+
+    std::mt19937 generator;
+
+    /*
+     * Buffers reused across samples and clusters so that the sampling loop
+     * does not allocate
+     */
+    std::vector<unsigned int> sample_indices;
+    Eigen::MatrixXf sample_matrix;
+    Eigen::VectorXf sample_values;
+    Eigen::VectorXf candidate;
+    Eigen::VectorXf best_candidate;
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXf> sample_solver;
+    MomentAccumulator inliers;
+};
+
+#endif // LINE_EXTRACTOR_IGVC_RANSACREGRESSION_H
@@ -8,6 +8,7 @@
 #ifndef LINE_EXTRACTOR_IGVC_REGRESSION_H
 #define LINE_EXTRACTOR_IGVC_REGRESSION_H
 
+#include "MomentAccumulator.h"
 #include <Eigen/Dense>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
@@ -24,28 +25,25 @@ class Regression {
      * PointCloud<PointXYZ> cluster
      * The corresponding vector and cluster have the same index within each of
      * their vectors.
+     * Clusters are fitted in parallel.
      * @poly_degree: Degree of polynomial of the line of best fit
      * @lambda: Regularization parameter (Default: 0)
      */
-    static std::vector<Eigen::VectorXf>
-    getLinesOfBestFit(std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters,
-                      unsigned int poly_degree,
-                      float lambda = 0);
+    static std::vector<Eigen::VectorXf> getLinesOfBestFit(
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+    unsigned int poly_degree,
+    float lambda = 0);
 
   private:
     /*
      * Returns a line of best fit given a cluster
+     * The fit is accumulated point by point with a MomentAccumulator, so it
+     * runs in O(n * d) without building an n x (d+1) matrix.
      */
     static Eigen::VectorXf
-    getLineOfCluster(pcl::PointCloud<pcl::PointXYZ> cluster,
+    getLineOfCluster(const pcl::PointCloud<pcl::PointXYZ>& cluster,
                      unsigned int poly_degree,
                      float lambda = 0);
-
-    /*
-     * Constructs a row in the matrix X given a data point and degree of
-     * polynomial
-     */
-    static Eigen::VectorXf constructRow(float x, unsigned int poly_degree);
 };
 
 #endif // PROJECT_REGRESSION_H
@@ -0,0 +1,61 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which finds the ground plane in a pointcloud
+ *              and publishes either only the points on it, or only the
+ *              points off it.
+ */
+
+#ifndef SB_POINTCLOUD_PROCESSING_GROUND_SEGMENTATION_H
+#define SB_POINTCLOUD_PROCESSING_GROUND_SEGMENTATION_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <sensor_msgs/PointCloud2.h>
+
+// PCL Includes
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <pcl_ros/point_cloud.h>
+
+#include <GroundPlaneSegmenter.h>
+
+namespace sb_pointcloud_processing {
+
+class GroundSegmentation : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    GroundSegmentation();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    /**
+     * Callback which splits a given pointcloud by its ground plane
+     *
+     * @param input the RGB pointcloud to be segmented
+     */
+    void callback(const sensor_msgs::PointCloud2::ConstPtr& input);
+
+    // Finds the ground plane, warm started from the previous cloud
+    GroundPlaneSegmenter segmenter;
+
+    // Whether to publish the ground points (true) or all other points (false)
+    bool keep_ground;
+
+    // Publishes the segmented pointcloud
+    ros::Publisher pub;
+
+    // Subscribes to the RGB pointcloud
+    ros::Subscriber sub;
+};
+}
+
+#endif // SB_POINTCLOUD_PROCESSING_GROUND_SEGMENTATION_H
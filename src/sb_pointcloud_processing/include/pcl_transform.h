@@ -0,0 +1,86 @@
+/**
+ * Created By: Valerian Ratu
+ * Created On: May 1 2017
+ * Description: A ros nodelet which transforms a given pointcloud from
+ *              it's current frame to a given frame
+ */
+
+#ifndef SB_POINTCLOUD_PROCESSING_PCL_TRANSFORM_H
+#define SB_POINTCLOUD_PROCESSING_PCL_TRANSFORM_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+#include <sensor_msgs/PointCloud2.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <PointCloudTransformer.h>
+#include <map>
+#include <memory>
+
+namespace sb_pointcloud_processing {
+
+class PCLTransform : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    PCLTransform();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    /**
+     * Callback which transforms a given pointcloud to the output frame
+     *
+     * Never blocks: clouds arriving within transform_period of the last
+     * published cloud are dropped, and clouds whose transform isn't
+     * available yet are dropped.
+     *
+     * @param input the pointcloud to be transformed
+     */
+    void callback(const sensor_msgs::PointCloud2::ConstPtr& input);
+
+    /**
+     * Gets the transform for clouds in the given frame
+     *
+     * If cache_transform is set, the transform is only looked up the first
+     * time a frame is seen, since the camera is rigidly mounted.
+     *
+     * @param frame_id the frame of the incoming cloud
+     * @param transform set to the transform to apply
+     * @return true if the transform is available, false otherwise
+     */
+    bool getTransform(const std::string& frame_id, Eigen::Affine3f& transform);
+
+    // The frame to transform pointclouds to
+    std::string output_frame;
+
+    // The minimum amount of time(s) between two published pointclouds
+    double transform_period;
+
+    // Whether to look up the transform for a frame only once
+    bool cache_transform;
+
+    // Cached transforms, keyed on the frame of the incoming cloud
+    std::map<std::string, Eigen::Affine3f> transforms;
+
+    ros::Time last_publish_time;
+    ros::Time last_exception_time;
+
+    // Listens for the transforms
+    tf2_ros::Buffer tf_buffer;
+    std::unique_ptr<tf2_ros::TransformListener> tf_listener;
+
+    // Publishes the transformed pointcloud
+    ros::Publisher pub;
+
+    // Subscribes to the pointcloud to be transformed
+    ros::Subscriber sub;
+};
+}
+
+#endif // SB_POINTCLOUD_PROCESSING_PCL_TRANSFORM_H
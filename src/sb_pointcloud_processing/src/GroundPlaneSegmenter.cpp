@@ -0,0 +1,183 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A class which finds the ground plane in a pointcloud and
+ *              splits the cloud into ground and non-ground points.
+ */
+
+#include <GroundPlaneSegmenter.h>
+#include <cmath>
+
+using namespace pcl;
+
+GroundPlaneSegmenter::GroundPlaneSegmenter(float distance_threshold,
+                                           unsigned int max_iterations,
+                                           Eigen::Vector3f up_axis,
+                                           float max_angle,
+                                           float min_inlier_ratio,
+                                           unsigned int max_scored_points)
+  : distance_threshold(distance_threshold),
+    max_iterations(max_iterations),
+    up_axis(up_axis.normalized()),
+    cos_max_angle(std::cos(max_angle)),
+    min_inlier_ratio(min_inlier_ratio),
+    max_scored_points(max_scored_points),
+    has_plane(false),
+    plane(Eigen::Vector4f::Zero()),
+    generator(123),
+    sampled_points(3, max_scored_points + 1),
+    num_sampled(0) {}
+
+bool GroundPlaneSegmenter::segment(const PointCloud<PointXYZRGB>& input,
+                                   PointCloud<PointXYZRGB>& ground,
+                                   PointCloud<PointXYZRGB>& non_ground) {
+    ground.clear();
+    non_ground.clear();
+    ground.header     = input.header;
+    non_ground.header = input.header;
+
+    samplePoints(input);
+    Eigen::Ref<const Eigen::Matrix3Xf> points =
+    sampled_points.leftCols(num_sampled);
+
+    // Try the plane from last time first, since the ground rarely moves
+    // much between clouds
+    bool found_plane = false;
+    if (has_plane) {
+        Eigen::Vector4f estimate = plane;
+        if (refinePlane(points, estimate) >= min_inlier_ratio &&
+            orientPlane(estimate)) {
+            plane       = estimate;
+            found_plane = true;
+        }
+    }
+
+    if (!found_plane) {
+        Eigen::Vector4f estimate;
+        if (ransacPlane(points, estimate)) {
+            refinePlane(points, estimate);
+            if (orientPlane(estimate)) {
+                plane       = estimate;
+                found_plane = true;
+            }
+        }
+    }
+
+    has_plane = found_plane;
+
+    if (!found_plane) {
+        non_ground = input;
+        return false;
+    }
+
+    for (size_t i = 0; i < input.size(); i++) {
+        const PointXYZRGB& p = input[i];
+        float distance =
+        plane(0) * p.x + plane(1) * p.y + plane(2) * p.z + plane(3);
+
+        if (std::fabs(distance) <= distance_threshold) {
+            ground.push_back(p);
+        } else {
+            non_ground.push_back(p);
+        }
+    }
+
+    return true;
+}
+
+void GroundPlaneSegmenter::samplePoints(const PointCloud<PointXYZRGB>& input) {
+    // Never more than max_scored_points, so they always fit
+    size_t step = input.size() / max_scored_points + 1;
+
+    num_sampled = 0;
+
+    for (size_t i = 0; i < input.size(); i += step) {
+        const PointXYZRGB& p = input[i];
+        if (!std::isfinite(p.x) || !std::isfinite(p.y) || !std::isfinite(p.z)) {
+            continue;
+        }
+        sampled_points.col(num_sampled++) = Eigen::Vector3f(p.x, p.y, p.z);
+    }
+}
+
+bool GroundPlaneSegmenter::ransacPlane(
+const Eigen::Ref<const Eigen::Matrix3Xf>& points, Eigen::Vector4f& result) {
+    unsigned int n = points.cols();
+    if (n < 3) { return false; }
+
+    std::uniform_int_distribution<unsigned int> distribution(0, n - 1);
+
+    unsigned int best_num_inliers = 0;
+
+    for (unsigned int iteration = 0; iteration < max_iterations; iteration++) {
+        Eigen::Vector3f p1 = points.col(distribution(generator));
+        Eigen::Vector3f p2 = points.col(distribution(generator));
+        Eigen::Vector3f p3 = points.col(distribution(generator));
+
+        Eigen::Vector3f normal = (p2 - p1).cross(p3 - p1);
+        float norm             = normal.norm();
+
+        // The points are (nearly) on a line, so they don't define a plane
+        if (norm < 1e-6) { continue; }
+        normal /= norm;
+
+        Eigen::Vector4f candidate;
+        candidate << normal, -normal.dot(p1);
+        if (!orientPlane(candidate)) { continue; }
+
+        unsigned int num_inliers =
+        (((candidate.head<3>().transpose() * points).array() + candidate(3))
+         .abs() <= distance_threshold)
+        .count();
+
+        if (num_inliers > best_num_inliers) {
+            best_num_inliers = num_inliers;
+            result           = candidate;
+        }
+    }
+
+    return best_num_inliers >= 3;
+}
+
+float GroundPlaneSegmenter::refinePlane(
+const Eigen::Ref<const Eigen::Matrix3Xf>& points,
+Eigen::Vector4f& estimate) const {
+    unsigned int n = points.cols();
+    if (n == 0) { return 0; }
+
+    Eigen::Array<bool, 1, Eigen::Dynamic> is_inlier =
+    ((estimate.head<3>().transpose() * points).array() + estimate(3)).abs() <=
+    distance_threshold;
+
+    unsigned int num_inliers = is_inlier.count();
+    if (num_inliers < 3) { return (float) num_inliers / n; }
+
+    // Least squares plane through the inliers: the normal is the direction
+    // of least variance about their centroid
+    Eigen::Vector3f centroid = Eigen::Vector3f::Zero();
+    for (unsigned int i = 0; i < n; i++) {
+        if (is_inlier(i)) { centroid += points.col(i); }
+    }
+    centroid /= num_inliers;
+
+    Eigen::Matrix3f covariance = Eigen::Matrix3f::Zero();
+    for (unsigned int i = 0; i < n; i++) {
+        if (is_inlier(i)) {
+            Eigen::Vector3f d = points.col(i) - centroid;
+            covariance += d * d.transpose();
+        }
+    }
+
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3f> solver(covariance);
+    Eigen::Vector3f normal = solver.eigenvectors().col(0);
+
+    estimate << normal, -normal.dot(centroid);
+
+    return (float) num_inliers / n;
+}
+
+bool GroundPlaneSegmenter::orientPlane(Eigen::Vector4f& candidate) const {
+    if (candidate.head<3>().dot(up_axis) < 0) { candidate = -candidate; }
+
+    return candidate.head<3>().dot(up_axis) >= cos_max_angle;
+}
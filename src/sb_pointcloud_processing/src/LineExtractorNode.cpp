@@ -35,6 +35,85 @@ LineExtractorNode::LineExtractorNode(int argc,
     float default_radius     = 0.1;
     SB_getParam(private_nh, radius_param, this->radius, default_radius);
 
+    std::string use_ransac_param = "use_ransac";
+    bool default_use_ransac      = false;
+    SB_getParam(
+    private_nh, use_ransac_param, this->useRansac, default_use_ransac);
+
+    std::string ransac_max_iterations_param = "ransac_max_iterations";
+    int default_ransac_max_iterations       = 100;
+    int ransac_max_iterations;
+    SB_getParam(private_nh,
+                ransac_max_iterations_param,
+                ransac_max_iterations,
+                default_ransac_max_iterations);
+
+    std::string ransac_inlier_threshold_param = "ransac_inlier_threshold";
+    float default_ransac_inlier_threshold     = 0.05;
+    float ransac_inlier_threshold;
+    SB_getParam(private_nh,
+                ransac_inlier_threshold_param,
+                ransac_inlier_threshold,
+                default_ransac_inlier_threshold);
+
+    std::string ransac_confidence_param = "ransac_confidence";
+    float default_ransac_confidence     = 0.99;
+    float ransac_confidence;
+    SB_getParam(private_nh,
+                ransac_confidence_param,
+                ransac_confidence,
+                default_ransac_confidence);
+
+    if (ransac_max_iterations < 0 || ransac_inlier_threshold < 0 ||
+        ransac_confidence <= 0 || ransac_confidence >= 1) {
+        ROS_DEBUG(
+        "Detected invalid RANSAC params - iterations and threshold must be "
+        "positive, and confidence must be between 0 and 1");
+        ros::shutdown();
+    }
+
+    this->ransac = RansacRegression(
+    ransac_max_iterations, ransac_inlier_threshold, ransac_confidence);
+
+    std::string use_tracking_param = "use_tracking";
+    bool default_use_tracking      = false;
+    SB_getParam(
+    private_nh, use_tracking_param, this->useTracking, default_use_tracking);
+
+    std::string corridor_width_param = "tracking_corridor_width";
+    float default_corridor_width     = 0.1;
+    float corridor_width;
+    SB_getParam(
+    private_nh, corridor_width_param, corridor_width, default_corridor_width);
+
+    std::string max_missed_frames_param = "tracking_max_missed_frames";
+    int default_max_missed_frames       = 3;
+    int max_missed_frames;
+    SB_getParam(private_nh,
+                max_missed_frames_param,
+                max_missed_frames,
+                default_max_missed_frames);
+
+    std::string prior_weight_param = "tracking_prior_weight";
+    float default_prior_weight     = 10;
+    float prior_weight;
+    SB_getParam(
+    private_nh, prior_weight_param, prior_weight, default_prior_weight);
+
+    if (corridor_width < 0 || max_missed_frames < 0 || prior_weight < 0) {
+        ROS_DEBUG(
+        "Detected invalid tracking params - make sure all params are "
+        "positive");
+        ros::shutdown();
+    }
+
+    // A tracked line needs at least as many points as it takes to start one
+    this->tracker = LineTracker(
+    corridor_width, max_missed_frames, this->minNeighbours, prior_weight);
+
+    // Tracked lines are refit with the same fitter that found them
+    if (this->useRansac) { this->tracker.setRansac(this->ransac); }
+
     std::string delta_x_param = "x_delta";
     float default_delta_x     = 0.01;
     SB_getParam(private_nh, delta_x_param, this->x_delta, default_delta_x);
@@ -64,6 +143,11 @@ LineExtractorNode::LineExtractorNode(int argc,
     publisher           = private_nh.advertise<mapping_igvc::LineObstacle>(
     topic_to_publish_to, queue_size);
 
+    // All lines found in a pointcloud, published together in one message
+    std::string array_topic_to_publish_to = "output_line_obstacles";
+    array_publisher = private_nh.advertise<mapping_igvc::LineObstacleArray>(
+    array_topic_to_publish_to, queue_size);
+
     std::string rviz_line_topic = "debug/output_line_obstacle";
     rviz_line_publisher = private_nh.advertise<visualization_msgs::Marker>(
     rviz_line_topic, queue_size);
@@ -97,24 +181,66 @@ const sensor_msgs::PointCloud2ConstPtr processed_pcl) {
 
 void LineExtractorNode::extractLines() {
     DBSCAN dbscan(this->minNeighbours, this->radius);
-    this->clusters = dbscan.findClusters(this->pclPtr);
 
-    std::vector<Eigen::VectorXf> lines = regression.getLinesOfBestFit(
-    this->clusters, this->degreePoly, this->lambda);
+    std::vector<Eigen::VectorXf> lines;
+    std::vector<unsigned int> ids;
+
+    if (this->useTracking) {
+        // Refit the lines we already know about using the points near them
+        pcl::PointCloud<pcl::PointXYZ> unassigned =
+        tracker.assignPoints(*this->pclPtr);
+        tracker.updateTracks(this->lambda);
+
+        // Only look for new lines amongst the leftover points
+        std::vector<pcl::PointCloud<pcl::PointXYZ>> new_clusters =
+        dbscan.findClusters(unassigned.makeShared());
+        tracker.addTracks(new_clusters, fitLines(new_clusters));
+
+        tracker.getSeenTracks(this->clusters, lines, ids);
+    } else {
+        this->clusters = dbscan.findClusters(this->pclPtr);
+        lines          = fitLines(this->clusters);
+    }
 
     std::vector<mapping_igvc::LineObstacle> line_obstacles =
     vectorsToMsgs(lines);
 
-    for (unsigned int i = 0; i < line_obstacles.size(); i++) {
-        publisher.publish(line_obstacles[i]);
+    for (unsigned int i = 0; i < ids.size(); i++) {
+        line_obstacles[i].id = ids[i];
     }
 
-    visualizeClusters();
-    visualizeLineObstacles(line_obstacles);
+    // Only pay for one message per line if someone is listening for them
+    if (publisher.getNumSubscribers() > 0) {
+        for (unsigned int i = 0; i < line_obstacles.size(); i++) {
+            publisher.publish(line_obstacles[i]);
+        }
+    }
+
+    mapping_igvc::LineObstacleArray line_obstacle_array;
+    line_obstacle_array.header    = pcl_conversions::fromPCL(pclPtr->header);
+    line_obstacle_array.obstacles = line_obstacles;
+    array_publisher.publish(line_obstacle_array);
+
+    // Building markers is expensive, so skip it if rviz isn't listening
+    if (rviz_cluster_publisher.getNumSubscribers() > 0) { visualizeClusters(); }
+    if (rviz_line_publisher.getNumSubscribers() > 0) {
+        visualizeLineObstacles(line_obstacles);
+    }
 
     return;
 }
 
+std::vector<Eigen::VectorXf> LineExtractorNode::fitLines(
+const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters) {
+    if (this->useRansac) {
+        return ransac.getLinesOfBestFit(
+        clusters, this->degreePoly, this->lambda);
+    }
+
+    return regression.getLinesOfBestFit(
+    clusters, this->degreePoly, this->lambda);
+}
+
 void LineExtractorNode::visualizeClusters() {
     std::vector<geometry_msgs::Point> cluster_points;
     std::vector<std_msgs::ColorRGBA> colors;
@@ -223,10 +349,11 @@ bool LineExtractorNode::areParamsInvalid() {
 
 std::vector<mapping_igvc::LineObstacle>
 LineExtractorNode::vectorsToMsgs(std::vector<Eigen::VectorXf> vectors) {
-    std::vector<mapping_igvc::LineObstacle> msgs;
+    std::vector<mapping_igvc::LineObstacle> msgs(vectors.size());
 
+#pragma omp parallel for
     for (unsigned int i = 0; i < vectors.size(); i++) {
-        msgs.push_back(vectorToLineObstacle(vectors[i], i));
+        msgs[i] = vectorToLineObstacle(vectors[i], i);
     }
 
     return msgs;
@@ -249,7 +376,8 @@ LineExtractorNode::vectorToLineObstacle(Eigen::VectorXf v,
 void LineExtractorNode::getClusterXRange(double& xmin,
                                          double& xmax,
                                          unsigned int cluster_index) {
-    pcl::PointCloud<pcl::PointXYZ> cluster = this->clusters[cluster_index];
+    const pcl::PointCloud<pcl::PointXYZ>& cluster =
+    this->clusters[cluster_index];
 
     double min, max;
 
@@ -0,0 +1,218 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Keeps track of lines across pointclouds
+ */
+
+#include <LineTracker.h>
+#include <algorithm>
+#include <cmath>
+
+LineTracker::LineTracker(float corridor_width,
+                         unsigned int max_missed_frames,
+                         unsigned int min_points,
+                         float prior_weight)
+  : corridor_width(corridor_width),
+    max_missed_frames(max_missed_frames),
+    min_points(min_points),
+    prior_weight(prior_weight),
+    next_id(1),
+    use_ransac(false) {}
+
+void LineTracker::setRansac(const RansacRegression& ransac) {
+    this->ransac = ransac;
+    use_ransac   = true;
+}
+
+pcl::PointCloud<pcl::PointXYZ>
+LineTracker::assignPoints(const pcl::PointCloud<pcl::PointXYZ>& cloud) {
+    track_clusters.assign(tracks.size(), pcl::PointCloud<pcl::PointXYZ>());
+
+    pcl::PointCloud<pcl::PointXYZ> unassigned;
+
+    for (unsigned int p = 0; p < cloud.size(); p++) {
+        const pcl::PointXYZ& point = cloud[p];
+
+        // Find the closest line whose corridor contains the point
+        int closest_track      = -1;
+        float closest_residual = corridor_width;
+
+        for (unsigned int t = 0; t < tracks.size(); t++) {
+            const LineTrack& track = tracks[t];
+            if (point.x < track.x_min - corridor_width ||
+                point.x > track.x_max + corridor_width) {
+                continue;
+            }
+
+            float residual =
+            fabs(point.y - evaluate(track.coefficients, point.x));
+            if (residual <= closest_residual) {
+                closest_residual = residual;
+                closest_track    = t;
+            }
+        }
+
+        if (closest_track >= 0) {
+            track_clusters[closest_track].push_back(point);
+        } else {
+            unassigned.push_back(point);
+        }
+    }
+
+    return unassigned;
+}
+
+void LineTracker::updateTracks(float lambda) {
+    std::vector<LineTrack> kept_tracks;
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> kept_clusters;
+
+    for (unsigned int t = 0; t < tracks.size(); t++) {
+        LineTrack& track                              = tracks[t];
+        const pcl::PointCloud<pcl::PointXYZ>& cluster = track_clusters[t];
+
+        if (cluster.size() >= min_points) {
+            refit(track, cluster, lambda);
+            track.missed_frames = 0;
+        } else {
+            track.missed_frames++;
+            if (track.missed_frames > max_missed_frames) { continue; }
+        }
+
+        kept_tracks.push_back(track);
+        kept_clusters.push_back(cluster);
+    }
+
+    tracks         = kept_tracks;
+    track_clusters = kept_clusters;
+
+    mergeTracks(lambda);
+}
+
+void LineTracker::mergeTracks(float lambda) {
+    // Tracks are kept in order of creation, so the first track of a line is
+    // the oldest, and keeps its id
+    for (unsigned int t = 0; t < tracks.size(); t++) {
+        for (unsigned int other = t + 1; other < tracks.size();) {
+            if (!isSameLine(tracks[t], tracks[other])) {
+                other++;
+                continue;
+            }
+
+            LineTrack& track                        = tracks[t];
+            pcl::PointCloud<pcl::PointXYZ>& cluster = track_clusters[t];
+            const LineTrack& merged                 = tracks[other];
+            const pcl::PointCloud<pcl::PointXYZ>& merged_cluster =
+            track_clusters[other];
+
+            for (unsigned int i = 0; i < merged_cluster.size(); i++) {
+                cluster.push_back(merged_cluster[i]);
+            }
+
+            if (track.missed_frames == 0 || merged.missed_frames == 0) {
+                // Refit over the points of both, which also covers the
+                // domains of both
+                refit(track, cluster, lambda);
+                track.missed_frames = 0;
+            } else {
+                track.x_min = std::min(track.x_min, merged.x_min);
+                track.x_max = std::max(track.x_max, merged.x_max);
+                track.missed_frames =
+                std::min(track.missed_frames, merged.missed_frames);
+            }
+
+            tracks.erase(tracks.begin() + other);
+            track_clusters.erase(track_clusters.begin() + other);
+
+            // The merged track may now overlap ones it didn't before
+            other = t + 1;
+        }
+    }
+}
+
+void LineTracker::addTracks(
+const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+const std::vector<Eigen::VectorXf>& lines) {
+    for (unsigned int i = 0; i < clusters.size() && i < lines.size(); i++) {
+        LineTrack track;
+        track.id            = next_id++;
+        track.coefficients  = lines[i];
+        track.missed_frames = 0;
+        setDomain(track, clusters[i]);
+
+        tracks.push_back(track);
+        track_clusters.push_back(clusters[i]);
+    }
+}
+
+void LineTracker::getSeenTracks(
+std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+std::vector<Eigen::VectorXf>& lines,
+std::vector<unsigned int>& ids) const {
+    clusters.clear();
+    lines.clear();
+    ids.clear();
+
+    for (unsigned int t = 0; t < tracks.size(); t++) {
+        if (tracks[t].missed_frames != 0) { continue; }
+
+        clusters.push_back(track_clusters[t]);
+        lines.push_back(tracks[t].coefficients);
+        ids.push_back(tracks[t].id);
+    }
+}
+
+void LineTracker::clear() {
+    tracks.clear();
+    track_clusters.clear();
+}
+
+float LineTracker::evaluate(const Eigen::VectorXf& line, float x) {
+    float y = 0;
+    for (int i = line.size() - 1; i >= 0; i--) { y = y * x + line(i); }
+    return y;
+}
+
+void LineTracker::refit(LineTrack& track,
+                        const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                        float lambda) {
+    // Warm start the fit from where the line was last time
+    unsigned int poly_degree = track.coefficients.size() - 1;
+    if (use_ransac) {
+        track.coefficients = ransac.fitWithPrior(
+        cluster, poly_degree, prior_weight + lambda, track.coefficients);
+    } else {
+        MomentAccumulator accumulator(poly_degree);
+        accumulator.addCluster(cluster);
+        track.coefficients =
+        accumulator.solveWithPrior(prior_weight + lambda, track.coefficients);
+    }
+
+    setDomain(track, cluster);
+}
+
+bool LineTracker::isSameLine(const LineTrack& first,
+                             const LineTrack& second) const {
+    float overlap_min = std::max(first.x_min, second.x_min);
+    float overlap_max = std::min(first.x_max, second.x_max);
+    if (overlap_min > overlap_max) { return false; }
+
+    float overlap_mid = (overlap_min + overlap_max) / 2;
+    for (float x : {overlap_min, overlap_mid, overlap_max}) {
+        float distance = fabs(evaluate(first.coefficients, x) -
+                              evaluate(second.coefficients, x));
+        if (distance > corridor_width) { return false; }
+    }
+
+    return true;
+}
+
+void LineTracker::setDomain(LineTrack& track,
+                            const pcl::PointCloud<pcl::PointXYZ>& cluster) {
+    if (cluster.size() == 0) { return; }
+
+    track.x_min = track.x_max = cluster[0].x;
+    for (unsigned int i = 1; i < cluster.size(); i++) {
+        track.x_min = std::min(track.x_min, cluster[i].x);
+        track.x_max = std::max(track.x_max, cluster[i].x);
+    }
+}
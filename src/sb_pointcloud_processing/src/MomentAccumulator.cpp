@@ -0,0 +1,110 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Incrementally accumulates the normal equations of a polynomial
+ *              least squares fit
+ */
+
+#include <MomentAccumulator.h>
+
+MomentAccumulator::MomentAccumulator(unsigned int poly_degree)
+  : poly_degree(poly_degree),
+    num_points(0),
+    x_power_sums(Eigen::VectorXd::Zero(2 * poly_degree + 1)),
+    xy_power_sums(Eigen::VectorXd::Zero(poly_degree + 1)) {}
+
+void MomentAccumulator::addPoint(float x, float y) {
+    accumulate(x, y, 1);
+    num_points++;
+}
+
+void MomentAccumulator::removePoint(float x, float y) {
+    if (num_points == 0) { return; }
+
+    accumulate(x, y, -1);
+    num_points--;
+
+    // Avoid leaving round-off residue behind once the fit is empty
+    if (num_points == 0) { clear(); }
+}
+
+void MomentAccumulator::addCluster(
+const pcl::PointCloud<pcl::PointXYZ>& cluster) {
+    for (unsigned int i = 0; i < cluster.size(); i++) {
+        addPoint(cluster[i].x, cluster[i].y);
+    }
+}
+
+void MomentAccumulator::removeCluster(
+const pcl::PointCloud<pcl::PointXYZ>& cluster) {
+    for (unsigned int i = 0; i < cluster.size(); i++) {
+        removePoint(cluster[i].x, cluster[i].y);
+    }
+}
+
+void MomentAccumulator::clear() {
+    num_points = 0;
+    x_power_sums.setZero();
+    xy_power_sums.setZero();
+}
+
+void MomentAccumulator::accumulate(float x, float y, double sign) {
+    // Build up successive powers of x by repeated multiplication rather than
+    // calling pow() for every term
+    double x_power = sign;
+
+    for (unsigned int k = 0; k <= poly_degree; k++) {
+        x_power_sums(k) += x_power;
+        xy_power_sums(k) += x_power * y;
+        x_power *= x;
+    }
+
+    for (unsigned int k = poly_degree + 1; k <= 2 * poly_degree; k++) {
+        x_power_sums(k) += x_power;
+        x_power *= x;
+    }
+}
+
+Eigen::MatrixXd MomentAccumulator::getMomentMatrix() const {
+    Eigen::MatrixXd moments(poly_degree + 1, poly_degree + 1);
+
+    for (unsigned int i = 0; i <= poly_degree; i++) {
+        for (unsigned int j = 0; j <= poly_degree; j++) {
+            moments(i, j) = x_power_sums(i + j);
+        }
+    }
+
+    return moments;
+}
+
+Eigen::VectorXf MomentAccumulator::solve(float lambda) const {
+    /*
+     * Linear Equation to solve:
+     * (X' * X + lambda * I) * w = X' * y
+     *
+     * Only the (d+1)x(d+1) matrix X' * X and the (d+1) vector X' * y are
+     * needed, both of which are kept up to date as points are added and
+     * removed.
+     */
+    Eigen::MatrixXd left = getMomentMatrix();
+    left.diagonal().array() += lambda;
+
+    Eigen::VectorXd line = left.ldlt().solve(xy_power_sums);
+
+    return line.cast<float>();
+}
+
+Eigen::VectorXf
+MomentAccumulator::solveWithPrior(float lambda,
+                                  const Eigen::VectorXf& prior) const {
+    if (prior.size() != xy_power_sums.size()) { return solve(lambda); }
+
+    Eigen::MatrixXd left = getMomentMatrix();
+    left.diagonal().array() += lambda;
+
+    Eigen::VectorXd right = xy_power_sums + lambda * prior.cast<double>();
+
+    Eigen::VectorXd line = left.ldlt().solve(right);
+
+    return line.cast<float>();
+}
@@ -0,0 +1,102 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A class which applies a rigid transform to the xyz fields of
+ *              a sensor_msgs PointCloud2 in place.
+ */
+
+#include <PointCloudTransformer.h>
+#include <algorithm>
+#include <cstring>
+
+Eigen::Affine3f
+PointCloudTransformer::toEigen(const geometry_msgs::Transform& transform) {
+    Eigen::Quaternionf rotation(transform.rotation.w,
+                                transform.rotation.x,
+                                transform.rotation.y,
+                                transform.rotation.z);
+    Eigen::Vector3f translation(
+    transform.translation.x, transform.translation.y, transform.translation.z);
+
+    Eigen::Affine3f eigen_transform = Eigen::Affine3f::Identity();
+    eigen_transform.translate(translation);
+    eigen_transform.rotate(rotation.normalized());
+
+    return eigen_transform;
+}
+
+bool PointCloudTransformer::transformInPlace(sensor_msgs::PointCloud2& cloud,
+                                             const Eigen::Affine3f& transform) {
+    int x_offset = getFloatFieldOffset(cloud, "x");
+    int y_offset = getFloatFieldOffset(cloud, "y");
+    int z_offset = getFloatFieldOffset(cloud, "z");
+    if (x_offset < 0 || y_offset < 0 || z_offset < 0) { return false; }
+
+    size_t num_points = (size_t) cloud.width * cloud.height;
+    if (num_points == 0) { return true; }
+
+    const Eigen::Matrix3f rotation    = transform.linear();
+    const Eigen::Vector3f translation = transform.translation();
+
+    uint8_t* data = cloud.data.data();
+
+    bool is_packed =
+    y_offset == x_offset + (int) sizeof(float) &&
+    z_offset == y_offset + (int) sizeof(float) &&
+    cloud.point_step % sizeof(float) == 0 &&
+    (reinterpret_cast<uintptr_t>(data + x_offset) % alignof(float)) == 0;
+
+    if (is_packed) {
+        // View the xyz of every point as a column of a 3 x n matrix, skipping
+        // over the other fields with the outer stride
+        Eigen::Map<Eigen::Matrix3Xf, Eigen::Unaligned, Eigen::OuterStride<>>
+        points(reinterpret_cast<float*>(data + x_offset),
+               3,
+               num_points,
+               Eigen::OuterStride<>(cloud.point_step / sizeof(float)));
+
+        // Eigen can't tell that the product doesn't alias the points, so
+        // assigning it straight back would evaluate it into a 3 x n temporary
+        // on the heap. Going through a fixed size block on the stack instead
+        // keeps the transform in place.
+        constexpr int BLOCK_SIZE = 256;
+        Eigen::Matrix<float, 3, BLOCK_SIZE> block;
+        for (size_t start = 0; start < num_points; start += BLOCK_SIZE) {
+            int n = (int) std::min((size_t) BLOCK_SIZE, num_points - start);
+            block.leftCols(n).noalias() =
+            rotation * points.middleCols(start, n);
+            points.middleCols(start, n) =
+            block.leftCols(n).colwise() + translation;
+        }
+        return true;
+    }
+
+    for (size_t i = 0; i < num_points; i++) {
+        uint8_t* point = data + i * cloud.point_step;
+
+        Eigen::Vector3f p;
+        memcpy(&p.x(), point + x_offset, sizeof(float));
+        memcpy(&p.y(), point + y_offset, sizeof(float));
+        memcpy(&p.z(), point + z_offset, sizeof(float));
+
+        p = rotation * p + translation;
+
+        memcpy(point + x_offset, &p.x(), sizeof(float));
+        memcpy(point + y_offset, &p.y(), sizeof(float));
+        memcpy(point + z_offset, &p.z(), sizeof(float));
+    }
+
+    return true;
+}
+
+int PointCloudTransformer::getFloatFieldOffset(
+const sensor_msgs::PointCloud2& cloud, const std::string& name) {
+    for (const sensor_msgs::PointField& field : cloud.fields) {
+        if (field.name == name &&
+            field.datatype == sensor_msgs::PointField::FLOAT32) {
+            return field.offset;
+        }
+    }
+
+    return -1;
+}
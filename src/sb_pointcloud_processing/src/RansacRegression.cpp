@@ -0,0 +1,223 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Calculates a line of best fit for each cluster of points,
+ *              ignoring outliers (MSAC variant of RANSAC)
+ */
+
+#include <RansacRegression.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RansacRegression::RansacRegression(unsigned int max_iterations,
+                                   float inlier_threshold,
+                                   float confidence,
+                                   unsigned int seed)
+  : max_iterations(max_iterations),
+    inlier_threshold(inlier_threshold),
+    confidence(confidence),
+    seed(seed),
+    generator(seed) {}
+
+void RansacRegression::setSeed(unsigned int seed) {
+    this->seed = seed;
+    generator.seed(seed);
+}
+
+void RansacRegression::setMaxIterations(unsigned int max_iterations) {
+    this->max_iterations = max_iterations;
+}
+
+void RansacRegression::setInlierThreshold(float inlier_threshold) {
+    this->inlier_threshold = inlier_threshold;
+}
+
+void RansacRegression::setConfidence(float confidence) {
+    this->confidence = confidence;
+}
+
+std::vector<Eigen::VectorXf> RansacRegression::getLinesOfBestFit(
+const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
+unsigned int poly_degree,
+float lambda) const {
+    std::vector<Eigen::VectorXf> lines(clusters.size());
+
+#pragma omp parallel
+    {
+        // Every thread gets its own sampler and buffers
+        RansacRegression local_ransac(*this);
+
+#pragma omp for schedule(dynamic)
+        for (int i = 0; i < (int) clusters.size(); i++) {
+            // Seed per cluster, so the result does not depend on which thread
+            // picked up which cluster
+            local_ransac.setSeed(this->seed + i);
+            lines[i] = local_ransac.fit(clusters[i], poly_degree, lambda);
+        }
+    }
+
+    return lines;
+}
+
+Eigen::VectorXf
+RansacRegression::fit(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                      unsigned int poly_degree,
+                      float lambda) {
+    findInliers(cluster, poly_degree);
+    return inliers.solve(lambda);
+}
+
+Eigen::VectorXf
+RansacRegression::fitWithPrior(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                               unsigned int poly_degree,
+                               float lambda,
+                               const Eigen::VectorXf& prior) {
+    findInliers(cluster, poly_degree);
+    return inliers.solveWithPrior(lambda, prior);
+}
+
+void RansacRegression::findInliers(
+const pcl::PointCloud<pcl::PointXYZ>& cluster, unsigned int poly_degree) {
+    reserveBuffers(poly_degree);
+
+    unsigned int n           = cluster.size();
+    unsigned int sample_size = poly_degree + 1;
+
+    // Not enough points to draw a sample from, fit all of them instead
+    if (n <= sample_size) {
+        inliers.addCluster(cluster);
+        return;
+    }
+
+    float best_cost                = std::numeric_limits<float>::max();
+    unsigned int best_num_inliers  = 0;
+    unsigned int needed_iterations = max_iterations;
+
+    for (unsigned int iteration = 0; iteration < needed_iterations;
+         iteration++) {
+        drawSample(n);
+        if (!fitSample(cluster)) { continue; }
+
+        unsigned int num_inliers;
+        float cost = scoreLine(cluster, candidate, num_inliers);
+
+        if (cost < best_cost) {
+            best_cost        = cost;
+            best_num_inliers = num_inliers;
+            best_candidate   = candidate;
+
+            // Terminate early once we are confident that an outlier free
+            // sample has been drawn, given the best inlier ratio so far
+            double inlier_ratio = (double) num_inliers / n;
+            double clean_chance = pow(inlier_ratio, sample_size);
+            if (clean_chance >= 1) { break; }
+            if (clean_chance > 0) {
+                double required = log(1 - confidence) / log(1 - clean_chance);
+                needed_iterations =
+                std::min(max_iterations, (unsigned int) std::ceil(required));
+            }
+        }
+    }
+
+    // The line is refit by least squares over the inliers of the best model
+    if (best_num_inliers >= sample_size) {
+        for (unsigned int i = 0; i < n; i++) {
+            const pcl::PointXYZ& point = cluster[i];
+            float residual = point.y - evaluate(best_candidate, point.x);
+            if (fabs(residual) <= inlier_threshold) {
+                inliers.addPoint(point.x, point.y);
+            }
+        }
+    } else {
+        inliers.addCluster(cluster);
+    }
+}
+
+void RansacRegression::drawSample(unsigned int num_points) {
+    std::uniform_int_distribution<unsigned int> distribution(0, num_points - 1);
+
+    for (unsigned int i = 0; i < sample_indices.size(); i++) {
+        bool is_duplicate;
+        do {
+            sample_indices[i] = distribution(generator);
+            is_duplicate      = false;
+            for (unsigned int j = 0; j < i; j++) {
+                if (sample_indices[j] == sample_indices[i]) {
+                    is_duplicate = true;
+                    break;
+                }
+            }
+        } while (is_duplicate);
+    }
+}
+
+bool RansacRegression::fitSample(
+const pcl::PointCloud<pcl::PointXYZ>& cluster) {
+    // Vandermonde system through the sampled points
+    for (unsigned int i = 0; i < sample_indices.size(); i++) {
+        const pcl::PointXYZ& point = cluster[sample_indices[i]];
+
+        float x_power = 1;
+        for (unsigned int j = 0; j < sample_indices.size(); j++) {
+            sample_matrix(i, j) = x_power;
+            x_power *= point.x;
+        }
+        sample_values(i) = point.y;
+    }
+
+    sample_solver.compute(sample_matrix);
+    if (sample_solver.rank() < sample_indices.size()) { return false; }
+
+    candidate = sample_solver.solve(sample_values);
+
+    return candidate.allFinite();
+}
+
+float RansacRegression::scoreLine(const pcl::PointCloud<pcl::PointXYZ>& cluster,
+                                  const Eigen::VectorXf& line,
+                                  unsigned int& num_inliers) const {
+    float threshold_squared = inlier_threshold * inlier_threshold;
+    float cost              = 0;
+    num_inliers             = 0;
+
+    for (unsigned int i = 0; i < cluster.size(); i++) {
+        float residual         = cluster[i].y - evaluate(line, cluster[i].x);
+        float residual_squared = residual * residual;
+
+        if (residual_squared <= threshold_squared) {
+            cost += residual_squared;
+            num_inliers++;
+        } else {
+            cost += threshold_squared;
+        }
+    }
+
+    return cost;
+}
+
+float RansacRegression::evaluate(const Eigen::VectorXf& line, float x) {
+    float y = 0;
+    for (int i = line.size() - 1; i >= 0; i--) { y = y * x + line(i); }
+    return y;
+}
+
+void RansacRegression::reserveBuffers(unsigned int poly_degree) {
+    unsigned int sample_size = poly_degree + 1;
+
+    if (sample_indices.size() != sample_size) {
+        sample_indices.resize(sample_size);
+        sample_matrix.resize(sample_size, sample_size);
+        sample_values.resize(sample_size);
+        candidate.resize(sample_size);
+        best_candidate.resize(sample_size);
+        sample_solver =
+        Eigen::ColPivHouseholderQR<Eigen::MatrixXf>(sample_size, sample_size);
+    }
+
+    if (inliers.getPolyDegree() != poly_degree) {
+        inliers = MomentAccumulator(poly_degree);
+    } else {
+        inliers.clear();
+    }
+}
@@ -7,25 +7,25 @@
 #include <Regression.h>
 
 std::vector<Eigen::VectorXf> Regression::getLinesOfBestFit(
-std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters,
+const std::vector<pcl::PointCloud<pcl::PointXYZ>>& clusters,
 unsigned int poly_degree,
 float lambda) {
-    std::vector<Eigen::VectorXf> lines;
+    // Clusters are independent of each other, so fit them in parallel
+    std::vector<Eigen::VectorXf> lines(clusters.size());
 
-    // Calculate line of best fit for each cluster
-    for (unsigned int i = 0; i < clusters.size(); i++) {
-        lines.push_back(getLineOfCluster(clusters[i], poly_degree, lambda));
+// Calculate line of best fit for each cluster
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < (int) clusters.size(); i++) {
+        lines[i] = getLineOfCluster(clusters[i], poly_degree, lambda);
     }
 
     return lines;
 }
 
 Eigen::VectorXf
-Regression::getLineOfCluster(pcl::PointCloud<pcl::PointXYZ> cluster,
+Regression::getLineOfCluster(const pcl::PointCloud<pcl::PointXYZ>& cluster,
                              unsigned int poly_degree,
                              float lambda) {
-    unsigned int n = cluster.size();
-
     /*
      * Linear Equation to solve:
      * X' * X + lambda * I = X' * y
@@ -46,40 +46,12 @@ Regression::getLineOfCluster(pcl::PointCloud<pcl::PointXYZ> cluster,
      * y is a column vector of size (n), where n is the number of points in the
      * cluster.
      * Each row of the vector corresponds to the y coordinate of a point.
+     *
+     * X itself is never built: X' * X and X' * y only depend on the sums of
+     * powers of x (and y), which are accumulated one point at a time.
      */
+    MomentAccumulator accumulator(poly_degree);
+    accumulator.addCluster(cluster);
 
-    Eigen::MatrixXf X(n, poly_degree + 1);
-    Eigen::VectorXf y(n);
-
-    for (unsigned int i = 0; i < cluster.size(); i++) {
-        pcl::PointXYZ point = cluster[i];
-
-        X.row(i) = constructRow(point.x, poly_degree);
-
-        y(i) = point.y;
-    }
-
-    Eigen::MatrixXf regularization(poly_degree + 1, poly_degree + 1);
-    regularization.setIdentity();
-    regularization *= lambda;
-
-    Eigen::MatrixXf left(X.transpose() * X + regularization);
-    Eigen::MatrixXf right(X.transpose() * y);
-
-    Eigen::VectorXf line(n);
-    line = (left).ldlt().solve(right);
-
-    return line;
+    return accumulator.solve(lambda);
 }
-
-Eigen::VectorXf Regression::constructRow(float x, unsigned int poly_degree) {
-    Eigen::VectorXf row(poly_degree + 1);
-
-    // linear bias
-    row(0) = 1;
-
-    // non-linear
-    for (unsigned int j = 1; j < poly_degree + 1; j++) { row(j) = pow(x, j); }
-
-    return row;
-}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/**
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which finds the ground plane in a pointcloud
+ *              and publishes either only the points on it, or only the
+ *              points off it.
+ */
+
+#include <ground_segmentation.h>
+#include <pluginlib/class_list_macros.h>
+#include <sb_utils.h>
+
+using namespace sb_pointcloud_processing;
+using namespace pcl;
+
+GroundSegmentation::GroundSegmentation() {}
+
+void GroundSegmentation::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    ros::NodeHandle& private_nh = getPrivateNodeHandle();
+
+    double distance_threshold;
+    SB_getParam(private_nh, "distance_threshold", distance_threshold, 0.05);
+
+    int max_iterations;
+    SB_getParam(private_nh, "max_iterations", max_iterations, 100);
+
+    double max_angle;
+    SB_getParam(private_nh, "max_angle", max_angle, 0.5);
+
+    double min_inlier_ratio;
+    SB_getParam(private_nh, "min_inlier_ratio", min_inlier_ratio, 0.3);
+
+    int max_scored_points;
+    SB_getParam(private_nh, "max_scored_points", max_scored_points, 2000);
+
+    // The input cloud is not transformed, so the up axis must be given in
+    // its frame (eg. (0, -1, 0) for a camera's optical frame)
+    double up_axis_x, up_axis_y, up_axis_z;
+    SB_getParam(private_nh, "up_axis_x", up_axis_x, 0.0);
+    SB_getParam(private_nh, "up_axis_y", up_axis_y, 0.0);
+    SB_getParam(private_nh, "up_axis_z", up_axis_z, 1.0);
+
+    SB_getParam(private_nh, "keep_ground", keep_ground, false);
+
+    if (distance_threshold <= 0 || max_iterations <= 0 ||
+        max_scored_points < 3 ||
+        (up_axis_x == 0 && up_axis_y == 0 && up_axis_z == 0)) {
+        NODELET_ERROR(
+        "Params 'distance_threshold' and 'max_iterations' must be positive, "
+        "'max_scored_points' must be at least 3, "
+        "and the up axis must not be zero");
+        return;
+    }
+
+    segmenter =
+    GroundPlaneSegmenter(distance_threshold,
+                         max_iterations,
+                         Eigen::Vector3f(up_axis_x, up_axis_y, up_axis_z),
+                         max_angle,
+                         min_inlier_ratio,
+                         max_scored_points);
+
+    sub = private_nh.subscribe("input", 1, &GroundSegmentation::callback, this);
+    pub = private_nh.advertise<PointCloud<PointXYZRGB>>("output", 1);
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+void GroundSegmentation::callback(
+const sensor_msgs::PointCloud2::ConstPtr& input) {
+    // Obtain the ROS pointcloud and convert into PCL Pointcloud2
+    PCLPointCloud2::Ptr pcl_input(new PCLPointCloud2);
+    pcl_conversions::toPCL(*(input), *(pcl_input));
+
+    // Converts from the Pointcloud2 format to PointcloudRGB
+    PointCloud<PointXYZRGB>::Ptr pcl_rgb(new PointCloud<PointXYZRGB>());
+    fromPCLPointCloud2(*pcl_input, *pcl_rgb);
+
+    PointCloud<PointXYZRGB>::Ptr ground(new PointCloud<PointXYZRGB>());
+    PointCloud<PointXYZRGB>::Ptr non_ground(new PointCloud<PointXYZRGB>());
+    if (!segmenter.segment(*pcl_rgb, *ground, *non_ground)) {
+        NODELET_WARN_THROTTLE(1.0, "Could not find the ground plane");
+    }
+
+    // Publishes the requested side of the plane
+    pub.publish(keep_ground ? ground : non_ground);
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(GroundSegmentation, nodelet::Nodelet)
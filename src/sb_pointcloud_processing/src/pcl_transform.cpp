@@ -1,73 +1,103 @@
 /*
  * Created By: Valerian Ratu
  * Created On: May 1 2017
- * Description: A node which transforms a given pointcloud from
+ * Description: A ros nodelet which transforms a given pointcloud from
  *              it's current frame to a given frame
  */
 
-#include <geometry_msgs/TransformStamped.h>
-#include <ros/ros.h>
-#include <sensor_msgs/PointCloud2.h>
-#include <tf2_ros/transform_listener.h>
-#include <tf2_sensor_msgs/tf2_sensor_msgs.h>
-
+#include <pcl_transform.h>
+#include <pluginlib/class_list_macros.h>
 #include <sb_utils.h>
 
-ros::Publisher pub;
-tf2_ros::Buffer tf_buffer;
-
-std::string output_frame;
-ros::Time last_exception_time;
-
-// The amount of time(s) for a new pointcloud transform to be published.
-double transform_period;
-
-void pointCloudCallback(const sensor_msgs::PointCloud2::ConstPtr& msg) {
-    try {
-        // Create an empty pointcloud
-        sensor_msgs::PointCloud2 output;
-        // Transform the pointcloud to the requested frame
-        geometry_msgs::TransformStamped tf_stamped = tf_buffer.lookupTransform(
-        msg->header.frame_id, output_frame, ros::Time(0), ros::Duration(0.1));
+using namespace sb_pointcloud_processing;
 
-        tf2::doTransform(*msg, output, tf_stamped);
-
-        output.header.frame_id = output_frame;
-
-        // Publish the transformed pointcloud
-        pub.publish(output);
-
-        ros::Duration(transform_period).sleep();
-    } catch (tf2::TransformException ex) {
-        if (ros::Time::now().toSec() - last_exception_time.toSec() > 1.0)
-            ROS_WARN("%s", ex.what());
+PCLTransform::PCLTransform() {}
 
-        last_exception_time = ros::Time::now();
-    }
-}
+void PCLTransform::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    ros::NodeHandle& private_nh = getPrivateNodeHandle();
 
-int main(int argc, char** argv) {
-    ros::init(argc, argv, "pointcloud_transformer");
-    ros::NodeHandle private_nh("~");
     if (!SB_getParam(private_nh, "output_frame", output_frame)) {
         // Error and exit if we didn't get a frame to transform to.
         // We need this to transform anything, and there is no reasonable
         // default
-        ROS_ERROR(
+        NODELET_ERROR(
         "Param 'output_frame' not provided. "
         "Can't  transform anything without a frame to transform it to");
-        return 1;
+        return;
     }
 
     double default_transform_period = 0;
     SB_getParam(
     private_nh, "transform_period", transform_period, default_transform_period);
 
-    ros::Subscriber sub =
-    private_nh.subscribe("/input_pointcloud", 1, pointCloudCallback);
+    bool default_cache_transform = true;
+    SB_getParam(
+    private_nh, "cache_transform", cache_transform, default_cache_transform);
+
+    tf_listener.reset(new tf2_ros::TransformListener(tf_buffer));
+
+    sub =
+    private_nh.subscribe("/input_pointcloud", 1, &PCLTransform::callback, this);
     pub =
     private_nh.advertise<sensor_msgs::PointCloud2>("/output_pointcloud", 1);
-    tf2_ros::TransformListener tfListener(tf_buffer);
-    ros::spin();
-    return 0;
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+void PCLTransform::callback(const sensor_msgs::PointCloud2::ConstPtr& input) {
+    // Drop clouds rather than sleeping, so we never hold up the spinner
+    ros::Time now = ros::Time::now();
+    if (transform_period > 0 && !last_publish_time.isZero() &&
+        (now - last_publish_time).toSec() < transform_period) {
+        return;
+    }
+
+    Eigen::Affine3f transform;
+    if (!getTransform(input->header.frame_id, transform)) { return; }
+
+    // Copy once, then transform the copy in place
+    sensor_msgs::PointCloud2::Ptr output(new sensor_msgs::PointCloud2(*input));
+    if (!PointCloudTransformer::transformInPlace(*output, transform)) {
+        NODELET_WARN_THROTTLE(1.0,
+                              "Pointcloud has no float x, y and z fields, "
+                              "can't transform it");
+        return;
+    }
+    output->header.frame_id = output_frame;
+
+    // Publish the transformed pointcloud
+    pub.publish(output);
+    last_publish_time = now;
+}
+
+bool PCLTransform::getTransform(const std::string& frame_id,
+                                Eigen::Affine3f& transform) {
+    if (cache_transform) {
+        auto cached_transform = transforms.find(frame_id);
+        if (cached_transform != transforms.end()) {
+            transform = cached_transform->second;
+            return true;
+        }
+    }
+
+    try {
+        // Take the latest transform that is already available rather than
+        // waiting for one
+        geometry_msgs::TransformStamped tf_stamped =
+        tf_buffer.lookupTransform(frame_id, output_frame, ros::Time(0));
+
+        transform = PointCloudTransformer::toEigen(tf_stamped.transform);
+        if (cache_transform) { transforms[frame_id] = transform; }
+
+        return true;
+    } catch (tf2::TransformException ex) {
+        if (ros::Time::now().toSec() - last_exception_time.toSec() > 1.0)
+            NODELET_WARN("%s", ex.what());
+
+        last_exception_time = ros::Time::now();
+        return false;
+    }
 }
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(PCLTransform, nodelet::Nodelet)
@@ -0,0 +1,112 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Compares the accuracy and run time of the least squares and
+ *              RANSAC line fits on noisy clusters with outlier lines, similar
+ *              to the ones generated by test_pcl_generator_node
+ *
+ * Usage: rosrun sb_pointcloud_processing regression_benchmark [num_trials]
+ */
+
+#include <RansacRegression.h>
+#include <Regression.h>
+#include <TestUtils.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/**
+ * Returns the mean absolute difference in y between two polynomials,
+ * sampled over the given domain
+ */
+float meanLineError(const std::vector<float>& expected,
+                    const Eigen::VectorXf& actual,
+                    float x_min,
+                    float x_max,
+                    float x_delta) {
+    float total_error       = 0;
+    unsigned int num_points = 0;
+
+    for (float x = x_min; x <= x_max; x += x_delta) {
+        float expected_y = 0, actual_y = 0;
+        for (unsigned int i = 0; i < expected.size(); i++) {
+            expected_y += expected[i] * pow(x, i);
+        }
+        for (unsigned int i = 0; i < actual.size(); i++) {
+            actual_y += actual(i) * pow(x, i);
+        }
+        total_error += fabs(expected_y - actual_y);
+        num_points++;
+    }
+
+    return total_error / num_points;
+}
+
+int main(int argc, char** argv) {
+    unsigned int num_trials = 50;
+    if (argc > 1) { num_trials = atoi(argv[1]); }
+
+    unsigned int poly_degree        = 2;
+    float x_min                     = -5;
+    float x_max                     = 5;
+    float x_delta                   = 0.01;
+    float max_noise                 = 0.05;
+    std::vector<float> line         = {1, 0.2, -0.01};
+    std::vector<float> outlier_line = {3};
+    float outlier_x_delta           = 0.1;
+
+    // Generate one cluster per trial, each with its own noise
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters(num_trials);
+    for (unsigned int i = 0; i < num_trials; i++) {
+        LineExtractor::TestUtils::LineArgs args(line, x_min, x_max, x_delta);
+        LineExtractor::TestUtils::addLineToPointCloud(
+        args, clusters[i], max_noise, max_noise, i);
+
+        LineExtractor::TestUtils::LineArgs outlier_args(
+        outlier_line, x_min, x_max, outlier_x_delta);
+        LineExtractor::TestUtils::addLineToPointCloud(
+        outlier_args, clusters[i], max_noise, max_noise, i);
+    }
+
+    RansacRegression ransac(100, 2 * max_noise, 0.99);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Eigen::VectorXf> least_squares_lines =
+    Regression::getLinesOfBestFit(clusters, poly_degree);
+    auto least_squares_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<Eigen::VectorXf> ransac_lines =
+    ransac.getLinesOfBestFit(clusters, poly_degree);
+    auto ransac_time = std::chrono::steady_clock::now() - start;
+
+    float least_squares_error = 0, ransac_error = 0;
+    for (unsigned int i = 0; i < num_trials; i++) {
+        least_squares_error += meanLineError(
+        line, least_squares_lines[i], x_min, x_max, outlier_x_delta);
+        ransac_error +=
+        meanLineError(line, ransac_lines[i], x_min, x_max, outlier_x_delta);
+    }
+
+    double least_squares_us =
+    std::chrono::duration<double, std::micro>(least_squares_time).count();
+    double ransac_us =
+    std::chrono::duration<double, std::micro>(ransac_time).count();
+
+    printf("%u clusters of %zu points (degree %u)\n",
+           num_trials,
+           clusters[0].size(),
+           poly_degree);
+    printf(
+    "%-15s %20s %20s\n", "method", "mean |y error| (m)", "time/cluster (us)");
+    printf("%-15s %20.4f %20.2f\n",
+           "least_squares",
+           least_squares_error / num_trials,
+           least_squares_us / num_trials);
+    printf("%-15s %20.4f %20.2f\n",
+           "ransac",
+           ransac_error / num_trials,
+           ransac_us / num_trials);
+
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for GroundPlaneSegmenter
+ */
+
+#include <GroundPlaneSegmenter.h>
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace pcl;
+
+class GroundPlaneSegmenterTest : public testing::Test {
+  protected:
+    /**
+     * Adds a grid of points on the plane z = slope * x + height
+     */
+    void addGround(PointCloud<PointXYZRGB>& cloud, float slope, float height) {
+        for (float x = 0; x < 4; x += 0.05) {
+            for (float y = -2; y < 2; y += 0.05) {
+                PointXYZRGB p;
+                p.x = x;
+                p.y = y;
+                p.z = slope * x + height;
+                cloud.push_back(p);
+            }
+        }
+    }
+
+    /**
+     * Adds a vertical wall of points at x = wall_x
+     */
+    void addWall(PointCloud<PointXYZRGB>& cloud, float wall_x) {
+        for (float y = -2; y < 2; y += 0.05) {
+            for (float z = 0.5; z < 2; z += 0.05) {
+                PointXYZRGB p;
+                p.x = wall_x;
+                p.y = y;
+                p.z = z;
+                cloud.push_back(p);
+            }
+        }
+    }
+
+    PointCloud<PointXYZRGB> ground, non_ground;
+};
+
+TEST_F(GroundPlaneSegmenterTest, flatGroundWithWall) {
+    PointCloud<PointXYZRGB> cloud;
+    addGround(cloud, 0, -0.5);
+    size_t num_ground = cloud.size();
+    addWall(cloud, 3);
+    size_t num_wall = cloud.size() - num_ground;
+
+    GroundPlaneSegmenter segmenter;
+    EXPECT_TRUE(segmenter.segment(cloud, ground, non_ground));
+
+    EXPECT_EQ(num_ground, ground.size());
+    EXPECT_EQ(num_wall, non_ground.size());
+
+    Eigen::Vector4f plane = segmenter.getPlane();
+    EXPECT_NEAR(0, plane(0), 1e-3);
+    EXPECT_NEAR(0, plane(1), 1e-3);
+    EXPECT_NEAR(1, plane(2), 1e-3);
+    EXPECT_NEAR(0.5, plane(3), 1e-3);
+}
+
+TEST_F(GroundPlaneSegmenterTest, wallIsNeverGround) {
+    // A wall with many more points than the ground must not be taken as the
+    // ground, since it is tilted too far from the up axis
+    PointCloud<PointXYZRGB> cloud;
+    addWall(cloud, 1);
+    addWall(cloud, 1.01);
+    addWall(cloud, 1.02);
+
+    GroundPlaneSegmenter segmenter;
+    EXPECT_FALSE(segmenter.segment(cloud, ground, non_ground));
+    EXPECT_FALSE(segmenter.hasPlane());
+    EXPECT_EQ(0, ground.size());
+    EXPECT_EQ(cloud.size(), non_ground.size());
+}
+
+TEST_F(GroundPlaneSegmenterTest, cameraOpticalFrame) {
+    // In a camera's optical frame x points right, y down and z forward, so
+    // the ground is y = camera height and a wall facing the camera is z = d
+    PointCloud<PointXYZRGB> cloud;
+    for (float z = 0.5; z < 4; z += 0.05) {
+        for (float x = -2; x < 2; x += 0.05) {
+            PointXYZRGB p;
+            p.x = x;
+            p.y = 0.5;
+            p.z = z;
+            cloud.push_back(p);
+        }
+    }
+    size_t num_ground = cloud.size();
+    for (float x = -2; x < 2; x += 0.05) {
+        for (float y = -1.5; y < 0.4; y += 0.05) {
+            PointXYZRGB p;
+            p.x = x;
+            p.y = y;
+            p.z = 3;
+            cloud.push_back(p);
+        }
+    }
+    size_t num_wall = cloud.size() - num_ground;
+
+    GroundPlaneSegmenter segmenter(0.05, 100, Eigen::Vector3f(0, -1, 0));
+    EXPECT_TRUE(segmenter.segment(cloud, ground, non_ground));
+
+    EXPECT_EQ(num_ground, ground.size());
+    EXPECT_EQ(num_wall, non_ground.size());
+
+    Eigen::Vector4f plane = segmenter.getPlane();
+    EXPECT_NEAR(0, plane(0), 1e-3);
+    EXPECT_NEAR(-1, plane(1), 1e-3);
+    EXPECT_NEAR(0, plane(2), 1e-3);
+    EXPECT_NEAR(0.5, plane(3), 1e-3);
+}
+
+TEST_F(GroundPlaneSegmenterTest, followsSlopeAcrossClouds) {
+    GroundPlaneSegmenter segmenter;
+
+    // The ground tilts a little more in each cloud, as if driving onto a ramp
+    for (int i = 0; i <= 5; i++) {
+        float slope = 0.04 * i;
+
+        PointCloud<PointXYZRGB> cloud;
+        addGround(cloud, slope, -0.5);
+        size_t num_ground = cloud.size();
+        addWall(cloud, 3);
+
+        EXPECT_TRUE(segmenter.segment(cloud, ground, non_ground));
+        EXPECT_EQ(num_ground, ground.size());
+
+        Eigen::Vector4f plane = segmenter.getPlane();
+        Eigen::Vector3f expected_normal =
+        Eigen::Vector3f(-slope, 0, 1).normalized();
+        EXPECT_NEAR(1, plane.head<3>().dot(expected_normal), 1e-4);
+    }
+}
+
+TEST_F(GroundPlaneSegmenterTest, skipsInvalidPoints) {
+    PointCloud<PointXYZRGB> cloud;
+    addGround(cloud, 0, 0);
+    size_t num_ground = cloud.size();
+
+    PointXYZRGB invalid;
+    invalid.x = invalid.y = invalid.z = NAN;
+    cloud.push_back(invalid);
+
+    GroundPlaneSegmenter segmenter;
+    EXPECT_TRUE(segmenter.segment(cloud, ground, non_ground));
+    EXPECT_EQ(num_ground, ground.size());
+    EXPECT_EQ(1, non_ground.size());
+}
+
+TEST_F(GroundPlaneSegmenterTest, emptyCloud) {
+    PointCloud<PointXYZRGB> cloud;
+
+    GroundPlaneSegmenter segmenter;
+    EXPECT_FALSE(segmenter.segment(cloud, ground, non_ground));
+    EXPECT_EQ(0, ground.size());
+    EXPECT_EQ(0, non_ground.size());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
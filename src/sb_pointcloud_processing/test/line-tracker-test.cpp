@@ -0,0 +1,182 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests tracking of lines across pointclouds
+ */
+
+#include "./TestUtils.h"
+#include <LineTracker.h>
+#include <Regression.h>
+#include <gtest/gtest.h>
+
+class LineTrackerTest : public testing::Test {
+  protected:
+    LineTrackerTest() : tracker(0.5, 1, 3, 10) {}
+
+    virtual void SetUp() {
+        LineExtractor::TestUtils::LineArgs args(coefficients, 0, 10, 0.1);
+        LineExtractor::TestUtils::addLineToPointCloud(args, line);
+
+        clusters = {line};
+        lines    = Regression::getLinesOfBestFit(clusters, 1);
+
+        // Start tracking the line
+        tracker.assignPoints(line);
+        tracker.updateTracks();
+        tracker.addTracks(clusters, lines);
+    }
+
+    std::vector<float> coefficients = {1, 0.5};
+    pcl::PointCloud<pcl::PointXYZ> line;
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters;
+    std::vector<Eigen::VectorXf> lines;
+    LineTracker tracker;
+};
+
+TEST_F(LineTrackerTest, NewTrackIsSeen) {
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> seen_clusters;
+    std::vector<Eigen::VectorXf> seen_lines;
+    std::vector<unsigned int> ids;
+    tracker.getSeenTracks(seen_clusters, seen_lines, ids);
+
+    ASSERT_EQ(1, ids.size());
+    EXPECT_EQ(1, ids[0]);
+    EXPECT_EQ(line.size(), seen_clusters[0].size());
+    EXPECT_TRUE(seen_lines[0].isApprox(lines[0]));
+    EXPECT_FLOAT_EQ(0, tracker.getTracks()[0].x_min);
+    EXPECT_NEAR(10, tracker.getTracks()[0].x_max, 0.1);
+}
+
+TEST_F(LineTrackerTest, SameLineKeepsItsId) {
+    // The line moves slightly between pointclouds
+    std::vector<float> moved_coefficients = {1.2, 0.5};
+    pcl::PointCloud<pcl::PointXYZ> moved_line;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(moved_coefficients, 0, 10, 0.1),
+    moved_line);
+
+    pcl::PointCloud<pcl::PointXYZ> unassigned =
+    tracker.assignPoints(moved_line);
+    EXPECT_EQ(0, unassigned.size());
+
+    tracker.updateTracks();
+
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> seen_clusters;
+    std::vector<Eigen::VectorXf> seen_lines;
+    std::vector<unsigned int> ids;
+    tracker.getSeenTracks(seen_clusters, seen_lines, ids);
+
+    ASSERT_EQ(1, ids.size());
+    EXPECT_EQ(1, ids[0]);
+    // The fit follows the new points, but is held back slightly by the
+    // previous coefficients
+    EXPECT_NEAR(1.2, seen_lines[0](0), 0.1);
+    EXPECT_LT(seen_lines[0](0), 1.2);
+    EXPECT_NEAR(0.5, seen_lines[0](1), 0.05);
+}
+
+TEST_F(LineTrackerTest, PointsOutsideCorridorAreUnassigned) {
+    pcl::PointCloud<pcl::PointXYZ> cloud = line;
+
+    // A second line far away from the tracked one
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs({20, 0}, 0, 10, 0.1), cloud);
+
+    // Points past the end of the tracked line
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(coefficients, 20, 30, 1), cloud);
+
+    pcl::PointCloud<pcl::PointXYZ> unassigned = tracker.assignPoints(cloud);
+
+    EXPECT_EQ(cloud.size() - line.size(), unassigned.size());
+}
+
+TEST_F(LineTrackerTest, UnseenTracksAreDropped) {
+    pcl::PointCloud<pcl::PointXYZ> empty;
+
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> seen_clusters;
+    std::vector<Eigen::VectorXf> seen_lines;
+    std::vector<unsigned int> ids;
+
+    // Missing a single pointcloud keeps the track around, but not seen
+    tracker.assignPoints(empty);
+    tracker.updateTracks();
+    EXPECT_EQ(1, tracker.getTracks().size());
+    tracker.getSeenTracks(seen_clusters, seen_lines, ids);
+    EXPECT_EQ(0, ids.size());
+
+    // Missing a second one drops it
+    tracker.assignPoints(empty);
+    tracker.updateTracks();
+    EXPECT_EQ(0, tracker.getTracks().size());
+}
+
+TEST_F(LineTrackerTest, NewTracksGetNewIds) {
+    pcl::PointCloud<pcl::PointXYZ> other_line;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs({20, 0}, 0, 10, 0.1), other_line);
+
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> other_clusters = {other_line};
+    tracker.addTracks(other_clusters,
+                      Regression::getLinesOfBestFit(other_clusters, 1));
+
+    ASSERT_EQ(2, tracker.getTracks().size());
+    EXPECT_EQ(1, tracker.getTracks()[0].id);
+    EXPECT_EQ(2, tracker.getTracks()[1].id);
+
+    tracker.clear();
+    EXPECT_EQ(0, tracker.getTracks().size());
+}
+
+TEST_F(LineTrackerTest, RansacRefitIgnoresOutliers) {
+    // Outliers close enough to the line to be assigned to it
+    pcl::PointCloud<pcl::PointXYZ> cloud = line;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs({1.45, 0.5}, 0, 10, 1), cloud);
+
+    LineTracker ransac_tracker = tracker;
+    ransac_tracker.setRansac(RansacRegression(200, 0.1, 0.99));
+
+    tracker.assignPoints(cloud);
+    tracker.updateTracks();
+    ransac_tracker.assignPoints(cloud);
+    ransac_tracker.updateTracks();
+
+    // Least squares is pulled towards the outliers, RANSAC is not
+    EXPECT_GT(tracker.getTracks()[0].coefficients(0), 1.02);
+    EXPECT_NEAR(1, ransac_tracker.getTracks()[0].coefficients(0), 0.01);
+    EXPECT_NEAR(0.5, ransac_tracker.getTracks()[0].coefficients(1), 0.01);
+}
+
+TEST_F(LineTrackerTest, TracksOnSameLineAreMerged) {
+    // A second track on (almost) the same line, and one on another line
+    pcl::PointCloud<pcl::PointXYZ> other_line;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs({20, 0}, 0, 10, 0.1), other_line);
+
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> new_clusters = {line,
+                                                                other_line};
+    std::vector<Eigen::VectorXf> new_lines =
+    Regression::getLinesOfBestFit(new_clusters, 1);
+    new_lines[0](0) += 0.1;
+    tracker.addTracks(new_clusters, new_lines);
+    ASSERT_EQ(3, tracker.getTracks().size());
+
+    pcl::PointCloud<pcl::PointXYZ> cloud = line;
+    for (const pcl::PointXYZ& point : other_line) { cloud.push_back(point); }
+    tracker.assignPoints(cloud);
+    tracker.updateTracks();
+
+    // The duplicate is merged into the oldest track of the line
+    ASSERT_EQ(2, tracker.getTracks().size());
+    EXPECT_EQ(1, tracker.getTracks()[0].id);
+    EXPECT_EQ(0, tracker.getTracks()[0].missed_frames);
+    EXPECT_NEAR(1, tracker.getTracks()[0].coefficients(0), 0.01);
+    EXPECT_EQ(3, tracker.getTracks()[1].id);
+    EXPECT_NEAR(20, tracker.getTracks()[1].coefficients(0), 0.01);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
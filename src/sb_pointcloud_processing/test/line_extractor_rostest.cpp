@@ -7,6 +7,7 @@
 #include "./TestUtils.h"
 #include <gtest/gtest.h>
 #include <mapping_igvc/LineObstacle.h>
+#include <mapping_igvc/LineObstacleArray.h>
 #include <pcl_conversions/pcl_conversions.h>
 #include <std_msgs/Float32.h>
 
@@ -31,6 +32,11 @@ class LineExtractorRosTest : public testing::Test {
                       1,
                       &LineExtractorRosTest::callback,
                       this);
+        test_array_subscriber =
+        nh_.subscribe("/line_extractor_node/output_line_obstacles",
+                      1,
+                      &LineExtractorRosTest::arrayCallback,
+                      this);
 
         // Let the publishers and subscribers set itself up timely
         ros::Rate loop_rate(1);
@@ -39,13 +45,19 @@ class LineExtractorRosTest : public testing::Test {
 
     ros::NodeHandle nh_;
     mapping_igvc::LineObstacle lineObstacle;
+    mapping_igvc::LineObstacleArray lineObstacleArray;
     ros::Publisher test_publisher;
     ros::Subscriber test_subscriber;
+    ros::Subscriber test_array_subscriber;
 
   public:
     void callback(const mapping_igvc::LineObstacle& line) {
         lineObstacle = line;
     }
+
+    void arrayCallback(const mapping_igvc::LineObstacleArray& lines) {
+        lineObstacleArray = lines;
+    }
 };
 
 TEST_F(LineExtractorRosTest, TestTwoNonLinearLinesWithNoise) {
@@ -103,6 +115,13 @@ TEST_F(LineExtractorRosTest, TestTwoNonLinearLinesWithNoise) {
 
     EXPECT_FLOAT_EQ(lineObstacle.x_min, true_min);
     EXPECT_FLOAT_EQ(lineObstacle.x_max, true_max);
+
+    // The batched message should contain the same single line
+    ASSERT_EQ(1, lineObstacleArray.obstacles.size());
+    EXPECT_EQ(lineObstacle.coefficients,
+              lineObstacleArray.obstacles[0].coefficients);
+    EXPECT_EQ(lineObstacle.x_min, lineObstacleArray.obstacles[0].x_min);
+    EXPECT_EQ(lineObstacle.x_max, lineObstacleArray.obstacles[0].x_max);
 }
 
 int main(int argc, char** argv) {
@@ -0,0 +1,160 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests incremental accumulation of the normal equations
+ */
+
+#include "./TestUtils.h"
+#include <MomentAccumulator.h>
+#include <gtest/gtest.h>
+
+TEST(MomentAccumulator, EmptyAccumulator) {
+    MomentAccumulator accumulator(3);
+
+    EXPECT_EQ(0, accumulator.getNumPoints());
+    EXPECT_EQ(3, accumulator.getPolyDegree());
+    EXPECT_EQ(4, accumulator.getMomentMatrix().rows());
+    EXPECT_EQ(4, accumulator.getMomentMatrix().cols());
+    EXPECT_DOUBLE_EQ(0, accumulator.getMomentMatrix().norm());
+    EXPECT_DOUBLE_EQ(0, accumulator.getMomentVector().norm());
+}
+
+TEST(MomentAccumulator, MomentsMatchDesignMatrix) {
+    unsigned int poly_degree = 2;
+    std::vector<float> xs    = {-1.5, 0, 2, 3.25};
+    std::vector<float> ys    = {4, -1, 0.5, 7};
+
+    MomentAccumulator accumulator(poly_degree);
+
+    Eigen::MatrixXd X(xs.size(), poly_degree + 1);
+    Eigen::VectorXd y(ys.size());
+
+    for (unsigned int i = 0; i < xs.size(); i++) {
+        accumulator.addPoint(xs[i], ys[i]);
+        for (unsigned int j = 0; j <= poly_degree; j++) {
+            X(i, j) = pow(xs[i], j);
+        }
+        y(i) = ys[i];
+    }
+
+    Eigen::MatrixXd expected_matrix = X.transpose() * X;
+    Eigen::VectorXd expected_vector = X.transpose() * y;
+
+    EXPECT_EQ(xs.size(), accumulator.getNumPoints());
+    EXPECT_TRUE(accumulator.getMomentMatrix().isApprox(expected_matrix));
+    EXPECT_TRUE(accumulator.getMomentVector().isApprox(expected_vector));
+}
+
+TEST(MomentAccumulator, PerfectQuadraticFit) {
+    std::vector<float> coefficients = {2, -3, 0.5};
+    LineExtractor::TestUtils::LineArgs args(coefficients, -10, 10, 0.5);
+
+    pcl::PointCloud<pcl::PointXYZ> pcl;
+    LineExtractor::TestUtils::addLineToPointCloud(args, pcl);
+
+    MomentAccumulator accumulator(2);
+    accumulator.addCluster(pcl);
+
+    Eigen::VectorXf line = accumulator.solve();
+
+    ASSERT_EQ(coefficients.size(), line.size());
+    for (unsigned int i = 0; i < coefficients.size(); i++) {
+        EXPECT_NEAR(coefficients[i], line(i), 1e-3);
+    }
+}
+
+TEST(MomentAccumulator, RemovingPointsUndoesAdding) {
+    std::vector<float> line_coefficients    = {1, 2};
+    std::vector<float> outlier_coefficients = {50};
+
+    pcl::PointCloud<pcl::PointXYZ> line_pcl;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(line_coefficients, 0, 20, 1), line_pcl);
+
+    pcl::PointCloud<pcl::PointXYZ> outlier_pcl;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(outlier_coefficients, 0, 5, 1),
+    outlier_pcl);
+
+    MomentAccumulator accumulator(1);
+    accumulator.addCluster(line_pcl);
+    accumulator.addCluster(outlier_pcl);
+
+    // The outliers should pull the fit away from the true line
+    Eigen::VectorXf polluted_line = accumulator.solve();
+    EXPECT_GT(fabs(polluted_line(0) - line_coefficients[0]), 1);
+
+    // Once they are removed, the fit should be exact again
+    accumulator.removeCluster(outlier_pcl);
+    EXPECT_EQ(line_pcl.size(), accumulator.getNumPoints());
+
+    Eigen::VectorXf line = accumulator.solve();
+    for (unsigned int i = 0; i < line_coefficients.size(); i++) {
+        EXPECT_NEAR(line_coefficients[i], line(i), 1e-3);
+    }
+}
+
+TEST(MomentAccumulator, RemovingAllPointsClears) {
+    MomentAccumulator accumulator(3);
+    accumulator.addPoint(1.5, 2);
+    accumulator.addPoint(-0.3, 7);
+    accumulator.removePoint(-0.3, 7);
+    accumulator.removePoint(1.5, 2);
+
+    EXPECT_EQ(0, accumulator.getNumPoints());
+    EXPECT_DOUBLE_EQ(0, accumulator.getMomentMatrix().norm());
+    EXPECT_DOUBLE_EQ(0, accumulator.getMomentVector().norm());
+
+    // Removing from an empty accumulator should do nothing
+    accumulator.removePoint(1, 1);
+    EXPECT_EQ(0, accumulator.getNumPoints());
+}
+
+TEST(MomentAccumulator, RegularizationShrinksCoefficients) {
+    std::vector<float> coefficients = {5, 3};
+    pcl::PointCloud<pcl::PointXYZ> pcl;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(coefficients, 0, 10, 1), pcl);
+
+    MomentAccumulator accumulator(1);
+    accumulator.addCluster(pcl);
+
+    Eigen::VectorXf unregularized = accumulator.solve();
+    Eigen::VectorXf regularized   = accumulator.solve(100);
+
+    EXPECT_LT(regularized.norm(), unregularized.norm());
+}
+
+TEST(MomentAccumulator, PriorPullsTowardsPreviousFit) {
+    std::vector<float> coefficients = {5, 3};
+    pcl::PointCloud<pcl::PointXYZ> pcl;
+    LineExtractor::TestUtils::addLineToPointCloud(
+    LineExtractor::TestUtils::LineArgs(coefficients, 0, 10, 1), pcl);
+
+    MomentAccumulator accumulator(1);
+    accumulator.addCluster(pcl);
+
+    // A prior that agrees with the data shouldn't change the fit
+    Eigen::VectorXf prior(2);
+    prior << 5, 3;
+    Eigen::VectorXf line = accumulator.solveWithPrior(1000, prior);
+    EXPECT_NEAR(5, line(0), 1e-3);
+    EXPECT_NEAR(3, line(1), 1e-3);
+
+    // A very strong prior should dominate the data
+    prior << 1, 1;
+    line = accumulator.solveWithPrior(1e9, prior);
+    EXPECT_NEAR(1, line(0), 1e-2);
+    EXPECT_NEAR(1, line(1), 1e-2);
+
+    // A prior of the wrong size is ignored
+    Eigen::VectorXf bad_prior(3);
+    bad_prior << 1, 1, 1;
+    EXPECT_TRUE(
+    accumulator.solveWithPrior(0, bad_prior).isApprox(accumulator.solve(0)));
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,120 @@
+#include "PointCloudTransformer.h"
+#include <gtest/gtest.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+using namespace pcl;
+
+class PointCloudTransformerTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        // Rotate 90 degrees about z, then move 1 along x
+        transform = Eigen::Affine3f::Identity();
+        transform.translate(Eigen::Vector3f(1, 0, 0));
+        transform.rotate(Eigen::AngleAxisf(M_PI / 2, Eigen::Vector3f::UnitZ()));
+    }
+
+    Eigen::Affine3f transform;
+};
+
+TEST_F(PointCloudTransformerTest, transformsPackedCloud) {
+    PointCloud<PointXYZRGB> input;
+    PointXYZRGB p1;
+    p1.x = 1;
+    p1.y = 0;
+    p1.z = 0;
+    p1.r = 45;
+    input.push_back(p1);
+
+    PointXYZRGB p2;
+    p2.x = 0;
+    p2.y = 2;
+    p2.z = 3;
+    p2.g = 174;
+    input.push_back(p2);
+
+    sensor_msgs::PointCloud2 cloud;
+    pcl::toROSMsg(input, cloud);
+
+    ASSERT_TRUE(PointCloudTransformer::transformInPlace(cloud, transform));
+
+    PointCloud<PointXYZRGB> output;
+    pcl::fromROSMsg(cloud, output);
+
+    ASSERT_EQ(2, output.size());
+
+    // (1, 0, 0) -> (1, 1, 0)
+    EXPECT_NEAR(1, output[0].x, 1e-5);
+    EXPECT_NEAR(1, output[0].y, 1e-5);
+    EXPECT_NEAR(0, output[0].z, 1e-5);
+
+    // (0, 2, 3) -> (-1, 0, 3)
+    EXPECT_NEAR(-1, output[1].x, 1e-5);
+    EXPECT_NEAR(0, output[1].y, 1e-5);
+    EXPECT_NEAR(3, output[1].z, 1e-5);
+
+    // Colours are left alone
+    EXPECT_EQ(45, output[0].r);
+    EXPECT_EQ(174, output[1].g);
+}
+
+TEST_F(PointCloudTransformerTest, transformsUnpackedCloud) {
+    // Fields out of order, so x, y and z are not next to each other
+    sensor_msgs::PointCloud2 cloud;
+    cloud.height     = 1;
+    cloud.width      = 1;
+    cloud.point_step = 16;
+    cloud.row_step   = 16;
+    cloud.fields.resize(3);
+    cloud.fields[0].name     = "z";
+    cloud.fields[0].offset   = 0;
+    cloud.fields[0].datatype = sensor_msgs::PointField::FLOAT32;
+    cloud.fields[0].count    = 1;
+    cloud.fields[1].name     = "x";
+    cloud.fields[1].offset   = 8;
+    cloud.fields[1].datatype = sensor_msgs::PointField::FLOAT32;
+    cloud.fields[1].count    = 1;
+    cloud.fields[2].name     = "y";
+    cloud.fields[2].offset   = 12;
+    cloud.fields[2].datatype = sensor_msgs::PointField::FLOAT32;
+    cloud.fields[2].count    = 1;
+
+    float point[4] = {3, 0, 0, 2};
+    cloud.data.resize(sizeof(point));
+    memcpy(cloud.data.data(), point, sizeof(point));
+
+    ASSERT_TRUE(PointCloudTransformer::transformInPlace(cloud, transform));
+
+    memcpy(point, cloud.data.data(), sizeof(point));
+    EXPECT_NEAR(3, point[0], 1e-5);
+    EXPECT_NEAR(-1, point[2], 1e-5);
+    EXPECT_NEAR(0, point[3], 1e-5);
+}
+
+TEST_F(PointCloudTransformerTest, rejectsCloudWithoutXYZ) {
+    sensor_msgs::PointCloud2 cloud;
+    EXPECT_FALSE(PointCloudTransformer::transformInPlace(cloud, transform));
+}
+
+TEST(PointCloudTransformer, convertsRosTransform) {
+    geometry_msgs::Transform ros_transform;
+    ros_transform.translation.x = 1;
+    ros_transform.translation.y = 2;
+    ros_transform.translation.z = 3;
+    // 90 degrees about x
+    ros_transform.rotation.x = sin(M_PI / 4);
+    ros_transform.rotation.w = cos(M_PI / 4);
+
+    Eigen::Affine3f transform = PointCloudTransformer::toEigen(ros_transform);
+    Eigen::Vector3f p         = transform * Eigen::Vector3f(0, 1, 0);
+
+    EXPECT_NEAR(1, p.x(), 1e-5);
+    EXPECT_NEAR(2, p.y(), 1e-5);
+    EXPECT_NEAR(4, p.z(), 1e-5);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
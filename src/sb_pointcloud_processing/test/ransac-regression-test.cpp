@@ -0,0 +1,101 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests calculation of line of best fit in the presence of
+ *              outliers
+ */
+
+#include "./TestUtils.h"
+#include <RansacRegression.h>
+#include <Regression.h>
+#include <gtest/gtest.h>
+
+class RansacRegressionTest : public testing::Test {
+  protected:
+    RansacRegressionTest() : ransac(200, 0.5, 0.99) {}
+
+    virtual void SetUp() {
+        // A noisy line with a cluster of far away outliers
+        LineExtractor::TestUtils::LineArgs line_args(
+        line_coefficients, 0, 20, 0.1);
+        LineExtractor::TestUtils::addLineToPointCloud(
+        line_args, cluster, 0.1, 0.1);
+
+        LineExtractor::TestUtils::LineArgs outlier_args(
+        outlier_coefficients, 0, 20, 1);
+        LineExtractor::TestUtils::addLineToPointCloud(outlier_args, cluster);
+    }
+
+    std::vector<float> line_coefficients    = {2, 0.5};
+    std::vector<float> outlier_coefficients = {30};
+    pcl::PointCloud<pcl::PointXYZ> cluster;
+    RansacRegression ransac;
+};
+
+TEST_F(RansacRegressionTest, IgnoresOutliers) {
+    Eigen::VectorXf line = ransac.fit(cluster, 1);
+
+    ASSERT_EQ(line_coefficients.size(), line.size());
+    for (unsigned int i = 0; i < line_coefficients.size(); i++) {
+        EXPECT_NEAR(line_coefficients[i], line(i), 0.1);
+    }
+
+    // Plain least squares should be pulled away by the outliers
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters = {cluster};
+    Eigen::VectorXf least_squares_line =
+    Regression::getLinesOfBestFit(clusters, 1)[0];
+    EXPECT_GT(fabs(least_squares_line(0) - line_coefficients[0]), 0.5);
+}
+
+TEST_F(RansacRegressionTest, MultipleClustersAreDeterministic) {
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters = {
+    cluster, cluster, cluster};
+
+    std::vector<Eigen::VectorXf> first_lines =
+    ransac.getLinesOfBestFit(clusters, 1);
+    std::vector<Eigen::VectorXf> second_lines =
+    ransac.getLinesOfBestFit(clusters, 1);
+
+    ASSERT_EQ(clusters.size(), first_lines.size());
+    ASSERT_EQ(clusters.size(), second_lines.size());
+
+    for (unsigned int i = 0; i < first_lines.size(); i++) {
+        EXPECT_TRUE(first_lines[i].isApprox(second_lines[i]));
+        EXPECT_NEAR(line_coefficients[0], first_lines[i](0), 0.1);
+        EXPECT_NEAR(line_coefficients[1], first_lines[i](1), 0.1);
+    }
+}
+
+TEST(RansacRegression, PerfectNonLinearFit) {
+    std::vector<float> coefficients = {1, -0.5, 0.2, 0.01};
+    LineExtractor::TestUtils::LineArgs args(coefficients, -5, 5, 0.1);
+
+    pcl::PointCloud<pcl::PointXYZ> cluster;
+    LineExtractor::TestUtils::addLineToPointCloud(args, cluster);
+
+    RansacRegression ransac;
+    Eigen::VectorXf line = ransac.fit(cluster, 3);
+
+    ASSERT_EQ(coefficients.size(), line.size());
+    for (unsigned int i = 0; i < coefficients.size(); i++) {
+        EXPECT_NEAR(coefficients[i], line(i), 1e-2);
+    }
+}
+
+TEST(RansacRegression, TooFewPointsFallsBackToLeastSquares) {
+    pcl::PointCloud<pcl::PointXYZ> cluster;
+    cluster.push_back(pcl::PointXYZ(0, 1, 0));
+    cluster.push_back(pcl::PointXYZ(1, 3, 0));
+
+    RansacRegression ransac;
+    Eigen::VectorXf line = ransac.fit(cluster, 1);
+
+    ASSERT_EQ(2, line.size());
+    EXPECT_NEAR(1, line(0), 1e-4);
+    EXPECT_NEAR(2, line(1), 1e-4);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
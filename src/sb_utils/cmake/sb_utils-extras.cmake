@@ -0,0 +1,10 @@
+# The replay harness is kept out of sb_utils_LIBRARIES, so that only the
+# benchmarks that read bags link it (and rosbag)
+if(TARGET sb_utils_replay)
+    set(sb_utils_REPLAY_LIBRARIES sb_utils_replay)
+else()
+    find_library(sb_utils_REPLAY_LIBRARIES sb_utils_replay
+        PATHS ${sb_utils_DIR}/../../../lib
+        NO_DEFAULT_PATH
+        )
+endif()
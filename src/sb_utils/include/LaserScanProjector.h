@@ -0,0 +1,93 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Converts LaserScan ranges to x/y points, using sin/cos tables
+ *              that are cached for the last few scan geometries
+ *
+ */
+#ifndef SB_UTILS_LASERSCANPROJECTOR_H
+#define SB_UTILS_LASERSCANPROJECTOR_H
+
+// STD
+#include <list>
+#include <tuple>
+#include <vector>
+
+// Messages
+#include <sensor_msgs/LaserScan.h>
+
+namespace snowbots {
+class LaserScanProjector {
+  public:
+    /**
+     * Converts every range in a scan to a point in the frame of the scan
+     *
+     * The angle of beam i is angle_min + i * angle_increment. Ranges outside
+     * of [range_min, range_max] are converted like any other, so callers
+     * should still check the range of a beam before using its point.
+     *
+     * @param scan the scan to convert
+     * @param x resized to the number of ranges, and set to the x of each beam
+     * @param y resized to the number of ranges, and set to the y of each beam
+     */
+    void project(const sensor_msgs::LaserScan& scan,
+                 std::vector<double>& x,
+                 std::vector<double>& y);
+
+    /**
+     * Gets the cosine of the angle of every beam in scans shaped like the
+     * given one, computing it only if this shape is not cached
+     *
+     * The table stays valid until its shape is dropped from the cache, after
+     * MAX_CACHED_SHAPES other shapes have been looked up.
+     *
+     * @param scan a scan with the angles and number of ranges to look up
+     * @return cos of the angle of each beam
+     */
+    const std::vector<double>& getCosTable(const sensor_msgs::LaserScan& scan);
+
+    /**
+     * Gets the sine of the angle of every beam in scans shaped like the given
+     * one, computing it only if this shape is not cached
+     *
+     * The table stays valid until its shape is dropped from the cache, after
+     * MAX_CACHED_SHAPES other shapes have been looked up.
+     *
+     * @param scan a scan with the angles and number of ranges to look up
+     * @return sin of the angle of each beam
+     */
+    const std::vector<double>& getSinTable(const sensor_msgs::LaserScan& scan);
+
+    /**
+     * @return the number of scan shapes with cached tables
+     */
+    size_t getNumCachedShapes() const { return tables.size(); }
+
+    // The most scan shapes kept in the cache, enough for a few lidars (or
+    // one that changes resolution) without a driver that jitters its angles
+    // growing the cache forever
+    static constexpr size_t MAX_CACHED_SHAPES = 4;
+
+  private:
+    // (angle_min, angle_increment, number of ranges)
+    using ScanShape = std::tuple<float, float, size_t>;
+
+    struct AngleTables {
+        std::vector<double> cos;
+        std::vector<double> sin;
+    };
+
+    /**
+     * Gets the tables for the shape of the given scan, creating them (and
+     * dropping the least recently used shape if the cache is full) if this
+     * shape is not cached
+     */
+    const AngleTables& getTables(const sensor_msgs::LaserScan& scan);
+
+    // Tables for the most recently used scan shapes, most recent first. A
+    // list, so moving a shape to the front doesn't move its tables.
+    std::list<std::pair<ScanShape, AngleTables>> tables;
+};
+}
+
+#endif // SB_UTILS_LASERSCANPROJECTOR_H
@@ -0,0 +1,94 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Loads recorded LaserScan sequences, from a bag or from a plain
+ *              binary dump that can be read without ROS, and times a function
+ *              over them for benchmarks
+ *
+ */
+
+#ifndef SB_UTILS_LASERSCANREPLAY_H
+#define SB_UTILS_LASERSCANREPLAY_H
+
+#include <LatencyHistogram.h>
+#include <chrono>
+#include <sensor_msgs/LaserScan.h>
+#include <string>
+#include <vector>
+
+namespace snowbots {
+
+/**
+ * Loads scans from a bag if the path ends in ".bag", or from a dump written
+ * by saveLaserScanDump otherwise
+ *
+ * @param path the bag or dump to load
+ * @param topic only the scans on this topic of a bag are loaded, or the scans
+ * on every topic if empty. Ignored for dumps
+ * @param scans the loaded scans are added to the end of this
+ * @return false if the file could not be read
+ */
+bool loadLaserScans(const std::string& path,
+                    const std::string& topic,
+                    std::vector<sensor_msgs::LaserScan>& scans);
+
+/**
+ * Loads every LaserScan in a bag
+ * @return false if the bag could not be read
+ */
+bool loadLaserScanBag(const std::string& path,
+                      const std::string& topic,
+                      std::vector<sensor_msgs::LaserScan>& scans);
+
+/**
+ * Loads the scans from a dump written by saveLaserScanDump
+ * @return false if the file could not be read or is not a dump
+ */
+bool loadLaserScanDump(const std::string& path,
+                       std::vector<sensor_msgs::LaserScan>& scans);
+
+/**
+ * Writes scans to a plain binary file, in the byte order of this machine
+ * @return false if the file could not be written
+ */
+bool saveLaserScanDump(const std::string& path,
+                       const std::vector<sensor_msgs::LaserScan>& scans);
+
+/**
+ * Times a function on every scan, one sample per call
+ *
+ * The scans are run through once untimed before timing starts, so buffers
+ * that grow to fit the largest scan are not counted.
+ *
+ * @param name what is being timed, printed with the histogram
+ * @param scans the scans to replay
+ * @param repeats how many times to replay all the scans
+ * @param process called with each scan
+ * @return the latency of each call
+ */
+template <typename Process>
+LatencyHistogram timeScans(const std::string& name,
+                           const std::vector<sensor_msgs::LaserScan>& scans,
+                           unsigned int repeats,
+                           Process process) {
+    LatencyHistogram histogram(name);
+
+    for (const sensor_msgs::LaserScan& scan : scans) { process(scan); }
+
+    for (unsigned int repeat = 0; repeat < repeats; repeat++) {
+        for (const sensor_msgs::LaserScan& scan : scans) {
+            auto start = std::chrono::steady_clock::now();
+            process(scan);
+            auto end = std::chrono::steady_clock::now();
+
+            histogram.add(
+            std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+
+    return histogram;
+}
+
+} // namespace snowbots
+
+#endif // SB_UTILS_LASERSCANREPLAY_H
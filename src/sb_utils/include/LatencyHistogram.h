@@ -0,0 +1,68 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Collects latency samples and summarizes them as percentiles
+ *              and a log-scale histogram, for benchmarks
+ *
+ */
+
+#ifndef SB_UTILS_LATENCYHISTOGRAM_H
+#define SB_UTILS_LATENCYHISTOGRAM_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace snowbots {
+
+class LatencyHistogram {
+  public:
+    /**
+     * @param name what is being timed, printed with the summary
+     */
+    explicit LatencyHistogram(std::string name = "");
+
+    /**
+     * Adds one sample
+     * @param microseconds how long the timed operation took
+     */
+    void add(double microseconds) { samples.push_back(microseconds); }
+
+    size_t count() const { return samples.size(); }
+
+    /**
+     * @return the mean of all samples, or 0 if there are none
+     */
+    double mean() const;
+
+    /**
+     * @param fraction between 0 and 1, e.g. 0.99 for the 99th percentile
+     * @return the smallest sample that at least that fraction of samples is
+     * less than or equal to, or 0 if there are no samples
+     */
+    double percentile(double fraction) const;
+
+    /**
+     * Counts the samples in buckets whose bounds double from one bucket to
+     * the next: bucket i holds samples in [2^(first_exponent + i),
+     * 2^(first_exponent + i + 1)) microseconds
+     * @param first_exponent set to the exponent of the first bucket's lower
+     * bound
+     * @return the number of samples in each bucket, from the first non-empty
+     * bucket to the last non-empty one
+     */
+    std::vector<size_t> getBuckets(int& first_exponent) const;
+
+    /**
+     * Prints the number of samples, mean, percentiles and histogram
+     */
+    void print(FILE* out = stdout) const;
+
+  private:
+    std::string name;
+    std::vector<double> samples;
+};
+
+} // namespace snowbots
+
+#endif // SB_UTILS_LATENCYHISTOGRAM_H
@@ -0,0 +1,176 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: The laser readings making up an obstacle, kept sorted by
+ *              angle in parallel arrays of angles and ranges, along with
+ *              running aggregates so the summary values of an obstacle
+ *              never need a pass over its readings
+ *
+ */
+#ifndef SB_UTILS_OBSTACLEREADINGS_H
+#define SB_UTILS_OBSTACLEREADINGS_H
+
+// STD
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace snowbots {
+template <typename T> class ObstacleReadings {
+  public:
+    /**
+     * Creates an ObstacleReadings with no readings
+     */
+    ObstacleReadings()
+      : angle_sum(0),
+        range_sum(0),
+        min_range(std::numeric_limits<T>::max()),
+        max_range(std::numeric_limits<T>::lowest()) {}
+
+    /**
+     * Adds a reading, keeping the readings sorted by angle
+     *
+     * Adding readings in order of angle (as they come from a scan) only
+     * appends them. A reading with the same angle as existing ones goes
+     * after them.
+     *
+     * @param angle the angle of the reading
+     * @param range the range of the reading
+     * @return the index the reading was put at
+     */
+    size_t add(T angle, T range) {
+        size_t index = angles.size();
+        if (!angles.empty() && angle < angles.back()) {
+            index = std::upper_bound(angles.begin(), angles.end(), angle) -
+                    angles.begin();
+        }
+        angles.insert(angles.begin() + index, angle);
+        ranges.insert(ranges.begin() + index, range);
+        addToAggregates(angle, range);
+        return index;
+    }
+
+    /**
+     * Merges in all readings from another ObstacleReadings
+     *
+     * @param other the readings to merge in
+     * @return true if the other readings all came after these ones, and so
+     * were just appended
+     */
+    bool merge(const ObstacleReadings& other) {
+        std::vector<size_t> order;
+        return merge(other, order);
+    }
+
+    /**
+     * Merges in all readings from another ObstacleReadings, giving where
+     * each merged reading came from so that data kept alongside the readings
+     * can be reordered to match
+     *
+     * @param other the readings to merge in
+     * @param order unless the other readings were just appended, set to the
+     * index of each merged reading in these readings followed by the other
+     * readings
+     * @return true if the other readings all came after these ones, and so
+     * were just appended
+     */
+    bool merge(const ObstacleReadings& other, std::vector<size_t>& order) {
+        angle_sum += other.angle_sum;
+        range_sum += other.range_sum;
+        min_range = std::min(min_range, other.min_range);
+        max_range = std::max(max_range, other.max_range);
+
+        if (other.empty() || empty() ||
+            !(other.angles.front() < angles.back())) {
+            angles.insert(
+            angles.end(), other.angles.begin(), other.angles.end());
+            ranges.insert(
+            ranges.end(), other.ranges.begin(), other.ranges.end());
+            return true;
+        }
+
+        // Both sets are sorted, so a single merge pass keeps them sorted.
+        // Ties go to these readings first, like add does.
+        size_t num_readings = size() + other.size();
+        std::vector<T> merged_angles, merged_ranges;
+        merged_angles.reserve(num_readings);
+        merged_ranges.reserve(num_readings);
+        order.clear();
+        order.reserve(num_readings);
+        size_t i = 0, j = 0;
+        while (i < size() || j < other.size()) {
+            if (j == other.size() ||
+                (i < size() && !(other.angles[j] < angles[i]))) {
+                merged_angles.emplace_back(angles[i]);
+                merged_ranges.emplace_back(ranges[i]);
+                order.emplace_back(i++);
+            } else {
+                merged_angles.emplace_back(other.angles[j]);
+                merged_ranges.emplace_back(other.ranges[j]);
+                order.emplace_back(size() + j++);
+            }
+        }
+        angles = std::move(merged_angles);
+        ranges = std::move(merged_ranges);
+        return false;
+    }
+
+    size_t size() const { return angles.size(); }
+
+    bool empty() const { return angles.empty(); }
+
+    /**
+     * @return the angles of the readings, from min to max
+     */
+    const std::vector<T>& getAngles() const { return angles; }
+
+    /**
+     * @return the ranges of the readings, in the same order as the angles
+     */
+    const std::vector<T>& getRanges() const { return ranges; }
+
+    // The summary values below are undefined if there are no readings
+
+    T getMinAngle() const { return angles.front(); }
+
+    T getMaxAngle() const { return angles.back(); }
+
+    /**
+     * @return the range of the reading with the smallest angle
+     */
+    T getFirstRange() const { return ranges.front(); }
+
+    /**
+     * @return the range of the reading with the largest angle
+     */
+    T getLastRange() const { return ranges.back(); }
+
+    T getMinRange() const { return min_range; }
+
+    T getMaxRange() const { return max_range; }
+
+    T getAvgAngle() const { return angle_sum / size(); }
+
+    T getAvgRange() const { return range_sum / size(); }
+
+  private:
+    void addToAggregates(T angle, T range) {
+        angle_sum += angle;
+        range_sum += range;
+        min_range = std::min(min_range, range);
+        max_range = std::max(max_range, range);
+    }
+
+    std::vector<T> angles;
+    std::vector<T> ranges;
+
+    // Summed in double so that long float obstacles don't lose precision
+    double angle_sum;
+    double range_sum;
+    T min_range;
+    T max_range;
+};
+}
+
+#endif // SB_UTILS_OBSTACLEREADINGS_H
@@ -0,0 +1,73 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Converts LaserScan ranges to x/y points, using sin/cos tables
+ *              that are cached for the last few scan geometries
+ *
+ */
+
+#include <LaserScanProjector.h>
+#include <cmath>
+
+using namespace snowbots;
+
+constexpr size_t LaserScanProjector::MAX_CACHED_SHAPES;
+
+void LaserScanProjector::project(const sensor_msgs::LaserScan& scan,
+                                 std::vector<double>& x,
+                                 std::vector<double>& y) {
+    const AngleTables& angle_tables = getTables(scan);
+
+    size_t count = scan.ranges.size();
+    x.resize(count);
+    y.resize(count);
+
+    // Plain loops over raw arrays, so the compiler can vectorize them
+    const float* __restrict ranges  = scan.ranges.data();
+    const double* __restrict cosine = angle_tables.cos.data();
+    const double* __restrict sine   = angle_tables.sin.data();
+    double* __restrict x_out        = x.data();
+    double* __restrict y_out        = y.data();
+
+    for (size_t i = 0; i < count; i++) { x_out[i] = ranges[i] * cosine[i]; }
+    for (size_t i = 0; i < count; i++) { y_out[i] = ranges[i] * sine[i]; }
+}
+
+const std::vector<double>&
+LaserScanProjector::getCosTable(const sensor_msgs::LaserScan& scan) {
+    return getTables(scan).cos;
+}
+
+const std::vector<double>&
+LaserScanProjector::getSinTable(const sensor_msgs::LaserScan& scan) {
+    return getTables(scan).sin;
+}
+
+const LaserScanProjector::AngleTables&
+LaserScanProjector::getTables(const sensor_msgs::LaserScan& scan) {
+    ScanShape shape(scan.angle_min, scan.angle_increment, scan.ranges.size());
+
+    auto found = tables.begin();
+    while (found != tables.end() && found->first != shape) found++;
+
+    if (found != tables.end()) {
+        tables.splice(tables.begin(), tables, found);
+        return found->second;
+    }
+
+    if (tables.size() >= MAX_CACHED_SHAPES) tables.pop_back();
+
+    tables.emplace_front(shape, AngleTables());
+    AngleTables& new_tables = tables.front().second;
+    new_tables.cos.resize(scan.ranges.size());
+    new_tables.sin.resize(scan.ranges.size());
+    for (size_t i = 0; i < scan.ranges.size(); i++) {
+        // The same (float) angle as computing it directly from the scan,
+        // with its sin and cos taken in double
+        double angle      = (float) (scan.angle_min + i * scan.angle_increment);
+        new_tables.cos[i] = std::cos(angle);
+        new_tables.sin[i] = std::sin(angle);
+    }
+
+    return new_tables;
+}
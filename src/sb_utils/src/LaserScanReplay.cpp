@@ -0,0 +1,147 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Loads recorded LaserScan sequences, from a bag or from a plain
+ *              binary dump that can be read without ROS
+ *
+ */
+
+#include <LaserScanReplay.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <rosbag/bag.h>
+#include <rosbag/view.h>
+
+using namespace snowbots;
+
+// Start of every dump, followed by the format version
+static const char DUMP_MAGIC[4]    = {'S', 'B', 'L', 'S'};
+static const uint32_t DUMP_VERSION = 1;
+
+template <typename T>
+static void writeValue(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T> static bool readValue(std::ifstream& in, T& value) {
+    return (bool) in.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+static void writeFloats(std::ofstream& out, const std::vector<float>& values) {
+    writeValue(out, (uint32_t) values.size());
+    out.write(reinterpret_cast<const char*>(values.data()),
+              values.size() * sizeof(float));
+}
+
+static bool readFloats(std::ifstream& in, std::vector<float>& values) {
+    uint32_t size;
+    if (!readValue(in, size)) { return false; }
+
+    values.resize(size);
+    return (bool) in.read(reinterpret_cast<char*>(values.data()),
+                          size * sizeof(float));
+}
+
+bool snowbots::loadLaserScans(const std::string& path,
+                              const std::string& topic,
+                              std::vector<sensor_msgs::LaserScan>& scans) {
+    std::string bag_extension = ".bag";
+    if (path.size() >= bag_extension.size() &&
+        path.compare(path.size() - bag_extension.size(),
+                     bag_extension.size(),
+                     bag_extension) == 0) {
+        return loadLaserScanBag(path, topic, scans);
+    }
+
+    return loadLaserScanDump(path, scans);
+}
+
+bool snowbots::loadLaserScanBag(const std::string& path,
+                                const std::string& topic,
+                                std::vector<sensor_msgs::LaserScan>& scans) {
+    try {
+        rosbag::Bag bag(path, rosbag::bagmode::Read);
+
+        rosbag::View view;
+        if (topic.empty()) {
+            view.addQuery(bag);
+        } else {
+            view.addQuery(bag, rosbag::TopicQuery(topic));
+        }
+
+        for (const rosbag::MessageInstance& message : view) {
+            sensor_msgs::LaserScan::ConstPtr scan =
+            message.instantiate<sensor_msgs::LaserScan>();
+            if (scan) { scans.push_back(*scan); }
+        }
+    } catch (const rosbag::BagException& e) { return false; }
+
+    return true;
+}
+
+bool snowbots::loadLaserScanDump(const std::string& path,
+                                 std::vector<sensor_msgs::LaserScan>& scans) {
+    std::ifstream in(path, std::ios::binary);
+
+    char magic[sizeof(DUMP_MAGIC)];
+    uint32_t version, num_scans;
+    if (!readValue(in, magic) || memcmp(magic, DUMP_MAGIC, sizeof(magic)) ||
+        !readValue(in, version) || version != DUMP_VERSION ||
+        !readValue(in, num_scans)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < num_scans; i++) {
+        sensor_msgs::LaserScan scan;
+
+        uint32_t frame_id_size;
+        if (!readValue(in, frame_id_size)) { return false; }
+        scan.header.frame_id.resize(frame_id_size);
+        if (!in.read(&scan.header.frame_id[0], frame_id_size)) { return false; }
+
+        if (!readValue(in, scan.header.seq) ||
+            !readValue(in, scan.header.stamp.sec) ||
+            !readValue(in, scan.header.stamp.nsec) ||
+            !readValue(in, scan.angle_min) || !readValue(in, scan.angle_max) ||
+            !readValue(in, scan.angle_increment) ||
+            !readValue(in, scan.time_increment) ||
+            !readValue(in, scan.scan_time) || !readValue(in, scan.range_min) ||
+            !readValue(in, scan.range_max) || !readFloats(in, scan.ranges) ||
+            !readFloats(in, scan.intensities)) {
+            return false;
+        }
+
+        scans.push_back(std::move(scan));
+    }
+
+    return true;
+}
+
+bool snowbots::saveLaserScanDump(
+const std::string& path, const std::vector<sensor_msgs::LaserScan>& scans) {
+    std::ofstream out(path, std::ios::binary);
+
+    writeValue(out, DUMP_MAGIC);
+    writeValue(out, DUMP_VERSION);
+    writeValue(out, (uint32_t) scans.size());
+
+    for (const sensor_msgs::LaserScan& scan : scans) {
+        writeValue(out, (uint32_t) scan.header.frame_id.size());
+        out.write(scan.header.frame_id.data(), scan.header.frame_id.size());
+        writeValue(out, scan.header.seq);
+        writeValue(out, scan.header.stamp.sec);
+        writeValue(out, scan.header.stamp.nsec);
+        writeValue(out, scan.angle_min);
+        writeValue(out, scan.angle_max);
+        writeValue(out, scan.angle_increment);
+        writeValue(out, scan.time_increment);
+        writeValue(out, scan.scan_time);
+        writeValue(out, scan.range_min);
+        writeValue(out, scan.range_max);
+        writeFloats(out, scan.ranges);
+        writeFloats(out, scan.intensities);
+    }
+
+    return (bool) out;
+}
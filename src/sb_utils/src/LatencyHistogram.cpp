@@ -0,0 +1,96 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Collects latency samples and summarizes them as percentiles
+ *              and a log-scale histogram, for benchmarks
+ *
+ */
+
+#include <LatencyHistogram.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace snowbots;
+
+// Width of the longest bar when printing the histogram
+static const int MAX_BAR_WIDTH = 40;
+
+LatencyHistogram::LatencyHistogram(std::string name) : name(std::move(name)) {}
+
+double LatencyHistogram::mean() const {
+    if (samples.empty()) { return 0; }
+
+    double total = 0;
+    for (double sample : samples) { total += sample; }
+    return total / samples.size();
+}
+
+double LatencyHistogram::percentile(double fraction) const {
+    if (samples.empty()) { return 0; }
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    // Nearest rank: the first sample with at least this fraction at or below
+    size_t rank = (size_t) std::ceil(fraction * sorted.size());
+    rank        = std::min(std::max(rank, (size_t) 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+std::vector<size_t> LatencyHistogram::getBuckets(int& first_exponent) const {
+    first_exponent = 0;
+    if (samples.empty()) { return {}; }
+
+    // Anything under a microsecond goes in the [0.5, 1) bucket, so a sample
+    // of 0 doesn't need a bucket of its own
+    auto exponent = [](double sample) {
+        return (int) std::floor(std::log2(std::max(sample, 0.5)));
+    };
+
+    int min_exponent = exponent(samples[0]);
+    int max_exponent = min_exponent;
+    for (double sample : samples) {
+        min_exponent = std::min(min_exponent, exponent(sample));
+        max_exponent = std::max(max_exponent, exponent(sample));
+    }
+
+    std::vector<size_t> buckets(max_exponent - min_exponent + 1, 0);
+    for (double sample : samples) {
+        buckets[exponent(sample) - min_exponent]++;
+    }
+
+    first_exponent = min_exponent;
+    return buckets;
+}
+
+void LatencyHistogram::print(FILE* out) const {
+    fprintf(out,
+            "%s: %zu samples, mean %.1f us, p50 %.1f us, p90 %.1f us, "
+            "p99 %.1f us, max %.1f us\n",
+            name.c_str(),
+            count(),
+            mean(),
+            percentile(0.5),
+            percentile(0.9),
+            percentile(0.99),
+            percentile(1));
+
+    int first_exponent;
+    std::vector<size_t> buckets = getBuckets(first_exponent);
+    size_t max_bucket           = 0;
+    for (size_t bucket : buckets) { max_bucket = std::max(max_bucket, bucket); }
+
+    for (size_t i = 0; i < buckets.size(); i++) {
+        double lower = std::ldexp(1.0, first_exponent + (int) i);
+        int bar_width =
+        (int) std::ceil((double) buckets[i] * MAX_BAR_WIDTH / max_bucket);
+
+        fprintf(out,
+                "  [%10.1f, %10.1f) us |%-*s| %zu\n",
+                lower,
+                2 * lower,
+                MAX_BAR_WIDTH,
+                std::string(bar_width, '#').c_str(),
+                buckets[i]);
+    }
+}
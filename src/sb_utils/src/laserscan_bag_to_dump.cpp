@@ -0,0 +1,34 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Copies the LaserScans in a bag to a plain binary dump, so the
+ *              LaserScan benchmarks can replay them without ROS
+ *
+ * Usage: rosrun sb_utils laserscan_bag_to_dump <in.bag> <out.dump> [topic]
+ */
+
+#include <LaserScanReplay.h>
+#include <cstdio>
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "Usage: %s <in.bag> <out.dump> [topic]\n", argv[0]);
+        return 1;
+    }
+
+    std::string topic = argc > 3 ? argv[3] : "";
+
+    std::vector<sensor_msgs::LaserScan> scans;
+    if (!snowbots::loadLaserScanBag(argv[1], topic, scans)) {
+        fprintf(stderr, "Could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    if (!snowbots::saveLaserScanDump(argv[2], scans)) {
+        fprintf(stderr, "Could not write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("Wrote %zu scans to %s\n", scans.size(), argv[2]);
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for LaserScanProjector
+ */
+
+#include <LaserScanProjector.h>
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace snowbots;
+
+class LaserScanProjectorTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        scan.angle_min       = -M_PI / 2;
+        scan.angle_max       = M_PI / 2;
+        scan.angle_increment = M_PI / 4;
+        scan.range_min       = 0.1;
+        scan.range_max       = 10;
+        scan.ranges          = {1, 2, 3, 4, 5};
+    }
+
+    sensor_msgs::LaserScan scan;
+    LaserScanProjector projector;
+    std::vector<double> x, y;
+};
+
+TEST_F(LaserScanProjectorTest, projectMatchesDirectConversion) {
+    projector.project(scan, x, y);
+
+    ASSERT_EQ(scan.ranges.size(), x.size());
+    ASSERT_EQ(scan.ranges.size(), y.size());
+    for (int i = 0; i < scan.ranges.size(); i++) {
+        double angle = scan.angle_min + i * scan.angle_increment;
+        EXPECT_DOUBLE_EQ(scan.ranges[i] * std::cos(angle), x[i]);
+        EXPECT_DOUBLE_EQ(scan.ranges[i] * std::sin(angle), y[i]);
+    }
+
+    EXPECT_NEAR(0, x[0], 1e-6);
+    EXPECT_NEAR(-1, y[0], 1e-6);
+    EXPECT_NEAR(3, x[2], 1e-6);
+    EXPECT_NEAR(0, y[2], 1e-6);
+    EXPECT_NEAR(0, x[4], 1e-6);
+    EXPECT_NEAR(5, y[4], 1e-6);
+}
+
+TEST_F(LaserScanProjectorTest, tablesAreReusedForTheSameShape) {
+    const std::vector<double>& cos_table = projector.getCosTable(scan);
+
+    // New ranges, same angles
+    scan.ranges = {5, 4, 3, 2, 1};
+    EXPECT_EQ(&cos_table, &projector.getCosTable(scan));
+
+    projector.project(scan, x, y);
+    EXPECT_NEAR(-5, y[0], 1e-6);
+}
+
+TEST_F(LaserScanProjectorTest, differentShapesGetDifferentTables) {
+    sensor_msgs::LaserScan fine_scan = scan;
+    fine_scan.angle_increment        = M_PI / 8;
+    fine_scan.ranges                 = std::vector<float>(9, 1);
+
+    const std::vector<double>& coarse_sin = projector.getSinTable(scan);
+    const std::vector<double>& fine_sin   = projector.getSinTable(fine_scan);
+
+    EXPECT_NE(&coarse_sin, &fine_sin);
+    EXPECT_EQ(5, coarse_sin.size());
+    EXPECT_EQ(9, fine_sin.size());
+
+    // Alternating between the two keeps both results correct
+    for (int i = 0; i < 3; i++) {
+        projector.project(fine_scan, x, y);
+        ASSERT_EQ(9, x.size());
+        EXPECT_NEAR(std::sin(M_PI / 8), y[5], 1e-6);
+
+        projector.project(scan, x, y);
+        ASSERT_EQ(5, x.size());
+        EXPECT_NEAR(4 * std::sin(M_PI / 4), y[3], 1e-6);
+    }
+}
+
+TEST_F(LaserScanProjectorTest, cacheIsBounded) {
+    projector.project(scan, x, y);
+
+    // A driver that jitters angle_min gives a new shape every scan
+    for (int i = 1; i <= 100; i++) {
+        sensor_msgs::LaserScan jittered = scan;
+        jittered.angle_min += i * 1e-4;
+        projector.project(jittered, x, y);
+        EXPECT_NEAR(std::sin(jittered.angle_min) * scan.ranges[0], y[0], 1e-6);
+    }
+    EXPECT_EQ(LaserScanProjector::MAX_CACHED_SHAPES,
+              projector.getNumCachedShapes());
+
+    // The first shape was dropped, and is recomputed correctly
+    const std::vector<double>& cos_table = projector.getCosTable(scan);
+    EXPECT_NEAR(std::cos(M_PI / 4), cos_table[1], 1e-6);
+}
+
+TEST_F(LaserScanProjectorTest, recentlyUsedShapesStayCached) {
+    const std::vector<double>& cos_table = projector.getCosTable(scan);
+
+    for (int i = 1; i <= 10; i++) {
+        sensor_msgs::LaserScan jittered = scan;
+        jittered.angle_min += i * 1e-4;
+        projector.getCosTable(jittered);
+
+        // Using the first shape between the others keeps it cached
+        EXPECT_EQ(&cos_table, &projector.getCosTable(scan));
+    }
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
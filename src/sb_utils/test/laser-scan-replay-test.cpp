@@ -0,0 +1,102 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for the LaserScan dump format and replay timing
+ */
+
+#include <LaserScanReplay.h>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace snowbots;
+
+class LaserScanReplayTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        sensor_msgs::LaserScan scan;
+        scan.header.frame_id   = "laser";
+        scan.header.seq        = 7;
+        scan.header.stamp.sec  = 100;
+        scan.header.stamp.nsec = 200;
+        scan.angle_min         = -1.5;
+        scan.angle_max         = 1.5;
+        scan.angle_increment   = 0.5;
+        scan.time_increment    = 0.001;
+        scan.scan_time         = 0.1;
+        scan.range_min         = 0.1;
+        scan.range_max         = 10;
+        scan.ranges            = {1, 2, 3, 4, 5, 6, 7};
+        scan.intensities       = {10, 20};
+        scans.push_back(scan);
+
+        // A scan with nothing optional set
+        scans.push_back(sensor_msgs::LaserScan());
+    }
+
+    virtual void TearDown() { remove(path.c_str()); }
+
+    std::string path = "laser-scan-replay-test.dump";
+    std::vector<sensor_msgs::LaserScan> scans;
+};
+
+TEST_F(LaserScanReplayTest, dumpRoundTrip) {
+    ASSERT_TRUE(saveLaserScanDump(path, scans));
+
+    std::vector<sensor_msgs::LaserScan> loaded;
+    ASSERT_TRUE(loadLaserScans(path, "", loaded));
+    ASSERT_EQ(scans.size(), loaded.size());
+
+    for (int i = 0; i < scans.size(); i++) {
+        EXPECT_EQ(scans[i].header.frame_id, loaded[i].header.frame_id);
+        EXPECT_EQ(scans[i].header.seq, loaded[i].header.seq);
+        EXPECT_EQ(scans[i].header.stamp.sec, loaded[i].header.stamp.sec);
+        EXPECT_EQ(scans[i].header.stamp.nsec, loaded[i].header.stamp.nsec);
+        EXPECT_EQ(scans[i].angle_min, loaded[i].angle_min);
+        EXPECT_EQ(scans[i].angle_max, loaded[i].angle_max);
+        EXPECT_EQ(scans[i].angle_increment, loaded[i].angle_increment);
+        EXPECT_EQ(scans[i].time_increment, loaded[i].time_increment);
+        EXPECT_EQ(scans[i].scan_time, loaded[i].scan_time);
+        EXPECT_EQ(scans[i].range_min, loaded[i].range_min);
+        EXPECT_EQ(scans[i].range_max, loaded[i].range_max);
+        EXPECT_EQ(scans[i].ranges, loaded[i].ranges);
+        EXPECT_EQ(scans[i].intensities, loaded[i].intensities);
+    }
+}
+
+TEST_F(LaserScanReplayTest, rejectsOtherFiles) {
+    std::vector<sensor_msgs::LaserScan> loaded;
+    EXPECT_FALSE(loadLaserScanDump(path, loaded));
+
+    std::ofstream(path) << "not a dump";
+    EXPECT_FALSE(loadLaserScanDump(path, loaded));
+}
+
+TEST_F(LaserScanReplayTest, rejectsTruncatedDump) {
+    ASSERT_TRUE(saveLaserScanDump(path, scans));
+
+    std::ifstream in(path, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(in)),
+                         std::istreambuf_iterator<char>());
+    in.close();
+    std::ofstream(path, std::ios::binary)
+    << contents.substr(0, contents.size() - 10);
+
+    std::vector<sensor_msgs::LaserScan> loaded;
+    EXPECT_FALSE(loadLaserScanDump(path, loaded));
+}
+
+TEST_F(LaserScanReplayTest, timeScansTimesEveryScanPerRepeat) {
+    int calls                  = 0;
+    LatencyHistogram histogram = timeScans(
+    "count", scans, 3, [&](const sensor_msgs::LaserScan& scan) { calls++; });
+
+    // One untimed warm up pass, then three timed ones
+    EXPECT_EQ(4 * scans.size(), calls);
+    EXPECT_EQ(3 * scans.size(), histogram.count());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,65 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for LatencyHistogram
+ */
+
+#include <LatencyHistogram.h>
+#include <gtest/gtest.h>
+
+using namespace snowbots;
+
+TEST(LatencyHistogram, emptyHistogram) {
+    LatencyHistogram histogram;
+
+    int first_exponent;
+    EXPECT_EQ(0, histogram.count());
+    EXPECT_EQ(0, histogram.mean());
+    EXPECT_EQ(0, histogram.percentile(0.5));
+    EXPECT_TRUE(histogram.getBuckets(first_exponent).empty());
+}
+
+TEST(LatencyHistogram, meanAndPercentiles) {
+    LatencyHistogram histogram;
+    for (int i = 100; i >= 1; i--) { histogram.add(i); }
+
+    EXPECT_EQ(100, histogram.count());
+    EXPECT_DOUBLE_EQ(50.5, histogram.mean());
+    EXPECT_EQ(1, histogram.percentile(0));
+    EXPECT_EQ(50, histogram.percentile(0.5));
+    EXPECT_EQ(90, histogram.percentile(0.9));
+    EXPECT_EQ(99, histogram.percentile(0.99));
+    EXPECT_EQ(100, histogram.percentile(1));
+}
+
+TEST(LatencyHistogram, bucketsDoubleInWidth) {
+    LatencyHistogram histogram;
+    histogram.add(3);  // [2, 4)
+    histogram.add(5);  // [4, 8)
+    histogram.add(7);  // [4, 8)
+    histogram.add(20); // [16, 32)
+
+    int first_exponent;
+    std::vector<size_t> buckets = histogram.getBuckets(first_exponent);
+
+    EXPECT_EQ(1, first_exponent);
+    EXPECT_EQ(std::vector<size_t>({1, 2, 0, 1}), buckets);
+}
+
+TEST(LatencyHistogram, tinySamplesShareTheFirstBucket) {
+    LatencyHistogram histogram;
+    histogram.add(0);
+    histogram.add(0.01);
+    histogram.add(0.7);
+
+    int first_exponent;
+    std::vector<size_t> buckets = histogram.getBuckets(first_exponent);
+
+    EXPECT_EQ(-1, first_exponent);
+    EXPECT_EQ(std::vector<size_t>({3}), buckets);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
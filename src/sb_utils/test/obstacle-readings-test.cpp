@@ -0,0 +1,78 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for ObstacleReadings
+ */
+
+#include <ObstacleReadings.h>
+#include <gtest/gtest.h>
+
+using namespace snowbots;
+
+TEST(ObstacleReadings, addKeepsReadingsSorted) {
+    ObstacleReadings<double> readings;
+    EXPECT_TRUE(readings.empty());
+
+    EXPECT_EQ(0, readings.add(0.2, 4));
+    EXPECT_EQ(1, readings.add(0.3, 1));
+    EXPECT_EQ(0, readings.add(0.1, 2));
+    EXPECT_EQ(2, readings.add(0.2, 3));
+
+    EXPECT_EQ(std::vector<double>({0.1, 0.2, 0.2, 0.3}), readings.getAngles());
+    EXPECT_EQ(std::vector<double>({2, 4, 3, 1}), readings.getRanges());
+}
+
+TEST(ObstacleReadings, summaryValues) {
+    ObstacleReadings<float> readings;
+    readings.add(-0.5, 3);
+    readings.add(0.5, 2);
+    readings.add(0, 7);
+
+    EXPECT_FLOAT_EQ(-0.5, readings.getMinAngle());
+    EXPECT_FLOAT_EQ(0.5, readings.getMaxAngle());
+    EXPECT_FLOAT_EQ(3, readings.getFirstRange());
+    EXPECT_FLOAT_EQ(2, readings.getLastRange());
+    EXPECT_FLOAT_EQ(2, readings.getMinRange());
+    EXPECT_FLOAT_EQ(7, readings.getMaxRange());
+    EXPECT_FLOAT_EQ(0, readings.getAvgAngle());
+    EXPECT_FLOAT_EQ(4, readings.getAvgRange());
+}
+
+TEST(ObstacleReadings, mergeAppendsLaterReadings) {
+    ObstacleReadings<double> readings, later_readings;
+    readings.add(0.1, 1);
+    later_readings.add(0.1, 2);
+    later_readings.add(0.2, 3);
+
+    std::vector<size_t> order;
+    EXPECT_TRUE(readings.merge(later_readings, order));
+    EXPECT_TRUE(order.empty());
+    EXPECT_EQ(std::vector<double>({0.1, 0.1, 0.2}), readings.getAngles());
+    EXPECT_EQ(std::vector<double>({1, 2, 3}), readings.getRanges());
+    EXPECT_DOUBLE_EQ(3, readings.getMaxRange());
+    EXPECT_DOUBLE_EQ(2, readings.getAvgRange());
+}
+
+TEST(ObstacleReadings, mergeInterleavesOverlappingReadings) {
+    ObstacleReadings<double> readings, other_readings;
+    readings.add(0.1, 1);
+    readings.add(0.3, 3);
+    other_readings.add(0, 10);
+    other_readings.add(0.2, 20);
+    other_readings.add(0.4, 40);
+
+    std::vector<size_t> order;
+    EXPECT_FALSE(readings.merge(other_readings, order));
+    EXPECT_EQ(std::vector<size_t>({2, 0, 3, 1, 4}), order);
+    EXPECT_EQ(std::vector<double>({0, 0.1, 0.2, 0.3, 0.4}),
+              readings.getAngles());
+    EXPECT_EQ(std::vector<double>({10, 1, 20, 3, 40}), readings.getRanges());
+    EXPECT_DOUBLE_EQ(1, readings.getMinRange());
+    EXPECT_DOUBLE_EQ(40, readings.getMaxRange());
+    EXPECT_DOUBLE_EQ(0.2, readings.getAvgAngle());
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
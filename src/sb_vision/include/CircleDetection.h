@@ -46,6 +46,15 @@ class CircleDetection {
      */
     CircleDetection(int argc, char** argv, std::string node_name);
 
+    /**
+     * Constructor for when ROS has already been initialized, such as in a
+     * nodelet
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    CircleDetection(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
     /**
      * Counts the number of circles found in the image.
      *
@@ -54,6 +63,14 @@ class CircleDetection {
     int countCircles(const Mat& filtered_image, bool display_circles = true);
 
   private:
+    /**
+     * Sets up the subscriber, publisher and params of the node
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    void setUpNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
     /**
      * Callback for the filtered image
      *
@@ -62,9 +79,10 @@ class CircleDetection {
     void filteredImageCallBack(const sensor_msgs::Image::ConstPtr& image);
 
     /**
-     * Converts ros::sensor_msgs::Image into a cv::Mat
+     * Wraps a ros::sensor_msgs::Image as a cv::Mat, sharing its data rather
+     * than copying it
      *
-     * @param message to be converted
+     * @param message to be converted, which must outlive the returned Mat
      */
     Mat rosToMat(const sensor_msgs::Image::ConstPtr& image);
 
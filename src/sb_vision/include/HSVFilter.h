@@ -13,6 +13,7 @@
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <stdio.h>
+#include <vector>
 
 class HSVFilter {
     // Thresholds
@@ -25,6 +26,30 @@ class HSVFilter {
 
     cv::Mat rangeOutput;
     cv::Mat hsvOutput;
+    cv::Mat smallInput;
+
+    // How many times smaller than the input the mask is made
+    int maskDownscale;
+
+    // Structuring elements for removing small objects from the mask and
+    // filling small holes in it, along with their reflections and the
+    // anchors that go with them. Eroding with an element then dilating with
+    // its reflection (or the other way around) is a true opening (or
+    // closing), which is what makes a single pass of each enough.
+    cv::Mat openElement, openElementReflected;
+    cv::Point openAnchorReflected;
+    cv::Mat closeElement, closeElementReflected;
+    cv::Point closeAnchorReflected;
+
+    // Whether to threshold with the lookup table instead of converting to HSV
+    bool useLookupTable;
+
+    // One bit for each 24 bit BGR colour, set if the colour is within the
+    // thresholds. Indexed by (blue << 16) | (green << 8) | red.
+    std::vector<uint8_t> lookupTable;
+
+    // The thresholds the lookup table was built for (lh, hh, ls, hs, lv, hv)
+    std::vector<int> lookupTableThresholds;
 
     // Window Names
     std::string manualCalibrationWindow;
@@ -49,6 +74,27 @@ class HSVFilter {
      */
     void filterImage(const cv::Mat& input, cv::Mat& output);
 
+    /**
+     * Sets how many times smaller than the input the mask is made before
+     * being scaled back up to the size of the input. Noise removal is scaled
+     * down with it.
+     *
+     * @param downscale 1 to make the mask at full size, 2 for half size, etc.
+     */
+    void setMaskDownscale(int downscale);
+
+    /**
+     * Sets whether to threshold images with a lookup table of every BGR
+     * colour, rather than converting them to HSV. The mask is the same
+     * either way, but a lookup per pixel is faster than the conversion.
+     *
+     * The table takes a moment to build, and is rebuilt whenever the
+     * thresholds have changed (during manual calibration).
+     *
+     * @param useTable true to use the lookup table, false otherwise
+     */
+    void setUseLookupTable(bool useTable);
+
     /**
      * Enables manual calibration of HSV values
      */
@@ -79,4 +125,30 @@ class HSVFilter {
      */
     void createFilter(
     int iLowH, int iHighH, int iLowS, int iHighS, int iLowV, int iHighV);
+
+    /**
+     * Builds the structuring elements for the current mask downscale
+     */
+    void createStructuringElements();
+
+    /**
+     * Makes a mask of the pixels of a BGR image within the thresholds
+     *
+     * @param input the image to threshold
+     * @param output set to the mask
+     */
+    void threshold(const cv::Mat& input, cv::Mat& output);
+
+    /**
+     * Rebuilds the lookup table if the thresholds have changed since it was
+     * last built
+     */
+    void updateLookupTable();
+
+    /**
+     * Removes small objects from a mask, then fills small holes in it
+     *
+     * @param mask the mask, which is filtered in place
+     */
+    void removeNoise(cv::Mat& mask);
 };
\ No newline at end of file
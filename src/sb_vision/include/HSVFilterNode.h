@@ -41,6 +41,7 @@
 #include <sb_utils.h>
 
 using namespace cv;
+using cv_bridge::CvImageConstPtr;
 
 class HSVFilterNode {
   public:
@@ -49,7 +50,24 @@ class HSVFilterNode {
      */
     HSVFilterNode(int argc, char** argv, std::string node_name);
 
+    /**
+     * Constructor for when ROS has already been initialized, such as in a
+     * nodelet
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    HSVFilterNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
   private:
+    /**
+     * Sets up the subscriber, publisher and params of the node
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    void setUpNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
     /**
      * Callback for the filtered image
      *
@@ -73,12 +91,15 @@ class HSVFilterNode {
      * image to be published
      */
     void showRawAndFilteredImageWindow();
+
     /**
-     * Converts ros::sensor_msgs::Image into a cv::Mat
+     * Wraps a ros::sensor_msgs::Image as a cv::Mat, sharing its data rather
+     * than copying it
      *
      * @param message to be converted
+     * @return the image, which keeps the message alive while it is held
      */
-    Mat rosToMat(const sensor_msgs::Image::ConstPtr& image);
+    CvImageConstPtr rosToMat(const sensor_msgs::Image::ConstPtr& image);
 
     /**
      * Subscribes to the raw camera image node
@@ -94,8 +115,12 @@ class HSVFilterNode {
     ros::Time last_published;
     ros::Duration publish_interval;
 
-    // Image processing Mat pipeline
-    cv::Mat imageInput;
+    // Handle to get the params that need the first image with
+    ros::NodeHandle private_nh;
+
+    // Image processing Mat pipeline (the input is shared with its message,
+    // so must never be written to)
+    cv_bridge::CvImageConstPtr imageInput;
     cv::Mat filterOutput;
 
     // The name and size of the display window
@@ -106,6 +131,12 @@ class HSVFilterNode {
     std::string mfilter_file;
     double frequency;
 
+    // How many times smaller than the image the filter makes its mask
+    int mask_downscale;
+
+    // Whether the filter thresholds with a lookup table of every colour
+    bool use_lookup_table;
+
     // Whether or not we've received the first image
     bool receivedFirstImage;
 
@@ -48,7 +48,20 @@ class IPM {
                     cv::Mat& _img) const;
 
   private:
-    void createMaps();
+    /**
+     * Creates remap maps for a homography, in the fixed point format remap
+     * is fastest with
+     *
+     * @param size the size of the image the maps produce
+     * @param H the homography from pixels of that image to pixels of the
+     * image being remapped
+     * @param map1 set to the integer pixel positions
+     * @param map2 set to the interpolation table indices
+     */
+    static void createMaps(const cv::Size& size,
+                           const cv::Mat& H,
+                           cv::Mat& map1,
+                           cv::Mat& map2);
 
     // Sizes
     cv::Size m_origSize;
@@ -61,9 +74,10 @@ class IPM {
     // Homography
     cv::Mat m_H;
     cv::Mat m_H_inv;
-    // Maps
-    cv::Mat m_mapX, m_mapY;
-    cv::Mat m_invMapX, m_invMapY;
+    // Maps, as CV_16SC2 positions and CV_16UC1 interpolation indices. The
+    // inverse maps are only created when first used.
+    cv::Mat m_map1, m_map2;
+    cv::Mat m_invMap1, m_invMap2;
 };
 
 #endif /*__IPM_H__*/
\ No newline at end of file
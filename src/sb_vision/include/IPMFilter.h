@@ -5,6 +5,9 @@
  *
  */
 
+#ifndef IPMFILTER_H
+#define IPMFILTER_H
+
 // OpenCV
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
@@ -48,6 +51,23 @@ class IPMFilter {
      */
     void filterImage(const cv::Mat& input, cv::Mat& output);
 
+    /**
+     * Gets the corners of the portion of the image the filter maps to the
+     * whole image, and the image corners they are mapped to
+     *
+     * @params image information and where to apply the IPM
+     * @param orig_points set to the corners in the original image
+     * @param dst_points set to the corners in the filtered image
+     */
+    static void getIPMPoints(float ipm_base_width,
+                             float ipm_top_width,
+                             float ipm_base_displacement,
+                             float ipm_top_displacement,
+                             float image_height,
+                             float image_width,
+                             std::vector<cv::Point2f>& orig_points,
+                             std::vector<cv::Point2f>& dst_points);
+
   private:
     /**
      * Initializator
@@ -61,14 +81,10 @@ class IPMFilter {
                       float image_height,
                       float image_width);
 
-    // Corners of the portion of the image to be filtered
-    int x1, y1;
-    int x2, y2;
-    int x3, y3;
-    int x4, y4;
-
     // Filters and their variables
     IPM ipm;
     std::vector<cv::Point2f> orig_points;
     std::vector<cv::Point2f> dst_points;
 };
+
+#endif // IPMFILTER_H
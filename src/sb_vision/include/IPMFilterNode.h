@@ -54,7 +54,24 @@ class IPMFilterNode {
      */
     IPMFilterNode(int argc, char** argv, std::string node_name);
 
+    /**
+     * Constructor for when ROS has already been initialized, such as in a
+     * nodelet
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    IPMFilterNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
   private:
+    /**
+     * Sets up the subscriber, publisher and params of the node
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    void setUpNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
     /**
      * Callback for the filtered image
      *
@@ -63,9 +80,10 @@ class IPMFilterNode {
     void filteredImageCallBack(const sensor_msgs::Image::ConstPtr& image);
 
     /**
-     * Converts ros::sensor_msgs::Image into a cv::Mat
+     * Wraps a ros::sensor_msgs::Image as a cv::Mat, sharing its data rather
+     * than copying it
      *
-     * @param message to be converted
+     * @param message to be converted, which must outlive the returned Mat
      */
     Mat rosToMat(const sensor_msgs::Image::ConstPtr& image);
 
@@ -79,6 +97,9 @@ class IPMFilterNode {
      */
     image_transport::Publisher ipm_filter_pub;
 
+    // Handle to get the params that need the first image with
+    ros::NodeHandle private_nh;
+
     // Whether or not we've received the first image
     bool receivedFirstImage;
 
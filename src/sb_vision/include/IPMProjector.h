@@ -0,0 +1,90 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Projects the white pixels of a camera mask straight onto the
+ *              ground in front of the robot, through the same homography
+ *              IPMFilter warps images with, without warping the image
+ */
+
+#ifndef SB_VISION_IPM_PROJECTOR_H
+#define SB_VISION_IPM_PROJECTOR_H
+
+// OpenCV
+#include <opencv2/core/core.hpp>
+
+// ROS
+#include <nav_msgs/OccupancyGrid.h>
+
+// STD
+#include <vector>
+
+class IPMProjector {
+  public:
+    /**
+     * Creates an IPMProjector for the same portion of the image as an
+     * IPMFilter with the same IPM params, given the area of the ground that
+     * portion covers. The area is a rectangle centered in front of the
+     * robot.
+     *
+     * @params the IPM params, as given to IPMFilter
+     * @param area_width the width of the area (in metres)
+     * @param area_length the length of the area away from the robot (in
+     * metres)
+     * @param area_distance the distance from the robot to the near edge of
+     * the area (in metres)
+     */
+    IPMProjector(float ipm_base_width,
+                 float ipm_top_width,
+                 float ipm_base_displacement,
+                 float ipm_top_displacement,
+                 float image_height,
+                 float image_width,
+                 double area_width,
+                 double area_length,
+                 double area_distance);
+
+    /**
+     * Projects a pixel onto the ground
+     *
+     * @param col the column of the pixel
+     * @param row the row of the pixel
+     * @param point set to where the pixel is on the ground relative to the
+     * robot, with x forward and y to the left (in metres)
+     * @return true if the pixel is in the area, false otherwise
+     */
+    bool projectPixel(double col, double row, cv::Point2d& point) const;
+
+    /**
+     * Projects every white pixel of a mask that is in the area onto the
+     * ground
+     *
+     * @param mask a mono8 mask, in which every non-zero pixel is white
+     * @param points set to where the pixels are on the ground, as given by
+     * projectPixel
+     */
+    void projectMask(const cv::Mat& mask,
+                     std::vector<cv::Point2d>& points) const;
+
+    /**
+     * Makes an occupancy grid of the area, with each cell containing a point
+     * occupied
+     *
+     * @param points the points on the ground, as given by projectMask
+     * @param resolution the size of each cell (in metres)
+     * @param grid set to the grid, with its origin at the corner of the area
+     * nearest the robot on its right. The header is left as is.
+     */
+    void makeOccupancyGrid(const std::vector<cv::Point2d>& points,
+                           double resolution,
+                           nav_msgs::OccupancyGrid& grid) const;
+
+  private:
+    // The homography from image pixels straight to metres on the ground
+    double H[9];
+
+    double area_width;
+    double area_length;
+    double area_distance;
+};
+
+#endif // SB_VISION_IPM_PROJECTOR_H
@@ -0,0 +1,92 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Projects the white pixels of filtered images straight onto
+ *              the ground, and publishes them as an occupancy grid
+ */
+
+#ifndef SB_VISION_IPM_PROJECTOR_NODE_H
+#define SB_VISION_IPM_PROJECTOR_NODE_H
+
+// Image Conversion
+#include <cv_bridge/cv_bridge.h>
+#include <image_transport/image_transport.h>
+
+// ROS
+#include <nav_msgs/OccupancyGrid.h>
+#include <ros/ros.h>
+#include <sensor_msgs/Image.h>
+
+// STD
+#include <memory>
+#include <string>
+#include <vector>
+
+// Snowbots
+#include <IPMProjector.h>
+#include <sb_utils.h>
+
+class IPMProjectorNode {
+  public:
+    /**
+     * Constructor
+     */
+    IPMProjectorNode(int argc, char** argv, std::string node_name);
+
+    /**
+     * Constructor for when ROS has already been initialized, such as in a
+     * nodelet
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    IPMProjectorNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
+  private:
+    /**
+     * Sets up the subscriber, publisher and params of the node
+     *
+     * @param nh the handle to advertise and subscribe with
+     * @param private_nh the handle to get params with
+     */
+    void setUpNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh);
+
+    /**
+     * Callback for the filtered image
+     *
+     * @param image the filtered image, a mono8 mask
+     */
+    void filteredImageCallBack(const sensor_msgs::Image::ConstPtr& image);
+
+    /**
+     * Subscribes to the filtered image
+     */
+    image_transport::Subscriber image_sub;
+
+    /**
+     * Publishes the occupancy grid
+     */
+    ros::Publisher grid_pub;
+
+    // Handle to get the params that need the first image with
+    ros::NodeHandle private_nh;
+
+    // Created once the first image gives its size
+    std::unique_ptr<IPMProjector> projector;
+
+    // Kept between images so that projecting doesn't allocate
+    std::vector<cv::Point2d> points;
+
+    // IPM Variables
+    float ipm_base_width, ipm_top_width, ipm_base_displacement,
+    ipm_top_displacement;
+
+    // The area of the ground the IPM portion of the image covers (in metres)
+    double area_width, area_length, area_distance;
+
+    // Grid Variables
+    double resolution;
+    std::string frame_id;
+};
+
+#endif // SB_VISION_IPM_PROJECTOR_NODE_H
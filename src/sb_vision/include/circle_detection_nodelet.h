@@ -0,0 +1,41 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which publishes whether circles are seen in
+ *              filtered images, see CircleDetection
+ */
+
+#ifndef SB_VISION_CIRCLE_DETECTION_NODELET_H
+#define SB_VISION_CIRCLE_DETECTION_NODELET_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+
+// STD
+#include <memory>
+
+#include <CircleDetection.h>
+
+namespace sb_vision {
+
+class CircleDetectionNodelet : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    CircleDetectionNodelet();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    // The node doing the work, set up with the nodelet's handles so its
+    // images are passed between nodelets by pointer
+    std::unique_ptr<CircleDetection> node;
+};
+}
+
+#endif // SB_VISION_CIRCLE_DETECTION_NODELET_H
@@ -0,0 +1,41 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which filters camera images in the HSV colourspace
+ *              to a binary image, see HSVFilterNode
+ */
+
+#ifndef SB_VISION_HSV_FILTER_NODELET_H
+#define SB_VISION_HSV_FILTER_NODELET_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+
+// STD
+#include <memory>
+
+#include <HSVFilterNode.h>
+
+namespace sb_vision {
+
+class HSVFilterNodelet : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    HSVFilterNodelet();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    // The node doing the work, set up with the nodelet's handles so its
+    // images are passed between nodelets by pointer
+    std::unique_ptr<HSVFilterNode> node;
+};
+}
+
+#endif // SB_VISION_HSV_FILTER_NODELET_H
@@ -0,0 +1,41 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which applies inverse perspective mapping to
+ *              filtered images, see IPMFilterNode
+ */
+
+#ifndef SB_VISION_IPM_FILTER_NODELET_H
+#define SB_VISION_IPM_FILTER_NODELET_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+
+// STD
+#include <memory>
+
+#include <IPMFilterNode.h>
+
+namespace sb_vision {
+
+class IPMFilterNodelet : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    IPMFilterNodelet();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    // The node doing the work, set up with the nodelet's handles so its
+    // images are passed between nodelets by pointer
+    std::unique_ptr<IPMFilterNode> node;
+};
+}
+
+#endif // SB_VISION_IPM_FILTER_NODELET_H
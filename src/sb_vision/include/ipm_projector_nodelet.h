@@ -0,0 +1,41 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which projects filtered images onto the ground
+ *              as an occupancy grid, see IPMProjectorNode
+ */
+
+#ifndef SB_VISION_IPM_PROJECTOR_NODELET_H
+#define SB_VISION_IPM_PROJECTOR_NODELET_H
+
+// ROS Includes
+#include <nodelet/nodelet.h>
+#include <ros/ros.h>
+
+// STD
+#include <memory>
+
+#include <IPMProjectorNode.h>
+
+namespace sb_vision {
+
+class IPMProjectorNodelet : public nodelet::Nodelet {
+  public:
+    /**
+     * Empty constructor
+     */
+    IPMProjectorNodelet();
+
+  private:
+    /**
+     * Initializes the nodelet
+     */
+    virtual void onInit();
+
+    // The node doing the work, set up with the nodelet's handles so its
+    // images are passed between nodelets by pointer
+    std::unique_ptr<IPMProjectorNode> node;
+};
+}
+
+#endif // SB_VISION_IPM_PROJECTOR_NODELET_H
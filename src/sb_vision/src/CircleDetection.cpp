@@ -36,6 +36,16 @@ CircleDetection::CircleDetection(int argc, char** argv, std::string node_name) {
     ros::NodeHandle nh;
     ros::NodeHandle private_nh("~");
 
+    setUpNode(nh, private_nh);
+}
+
+CircleDetection::CircleDetection(ros::NodeHandle& nh,
+                                 ros::NodeHandle& private_nh) {
+    setUpNode(nh, private_nh);
+}
+
+void CircleDetection::setUpNode(ros::NodeHandle& nh,
+                                ros::NodeHandle& private_nh) {
     // Setup image transport
     image_transport::ImageTransport it(nh);
 
@@ -58,16 +68,15 @@ CircleDetection::CircleDetection(int argc, char** argv, std::string node_name) {
 void CircleDetection::filteredImageCallBack(
 const sensor_msgs::Image::ConstPtr& image) {
     // If something is seen tell the robot to move
-    int num_circles = countCircles(rosToMat(image));
+    int num_circles = countCircles(rosToMat(image), show_window);
     std_msgs::Bool circle_detected;
     circle_detected.data = num_circles > 0;
     activity_publisher.publish(circle_detected);
 }
 
 Mat CircleDetection::rosToMat(const sensor_msgs::Image::ConstPtr& image) {
-    CvImagePtr image_ptr;
-    image_ptr = toCvCopy(image, image->encoding);
-    return image_ptr->image;
+    // countCircles never writes to the image, so there's no need to copy it
+    return toCvShare(image)->image;
 }
 
 int CircleDetection::countCircles(const Mat& filtered_image,
@@ -10,6 +10,27 @@
 
 #include <HSVFilter.h>
 
+// STD
+#include <algorithm>
+
+// The sizes of the structuring elements for a full size mask
+static const int OPEN_ELEMENT_SIZE  = 2;
+static const int CLOSE_ELEMENT_SIZE = 10;
+
+/**
+ * Reflects a structuring element through its (default) anchor
+ *
+ * @param element the structuring element
+ * @param reflected set to the reflected element
+ * @param anchor set to the anchor of the reflected element
+ */
+static void
+reflectElement(const cv::Mat& element, cv::Mat& reflected, cv::Point& anchor) {
+    cv::flip(element, reflected, -1);
+    anchor = cv::Point(element.cols - 1 - element.cols / 2,
+                       element.rows - 1 - element.rows / 2);
+}
+
 // Two different constructors
 HSVFilter::HSVFilter() {
     int sensitivity = 30;
@@ -31,6 +52,66 @@ int iLowH, int iHighH, int iLowS, int iHighS, int iLowV, int iHighV) {
     _iLowV                  = iLowV;
     _iHighV                 = iHighV;
     manualCalibrationWindow = "Manual Calibration";
+    maskDownscale           = 1;
+    useLookupTable          = false;
+    createStructuringElements();
+}
+
+void HSVFilter::createStructuringElements() {
+    int openSize  = std::max(1, OPEN_ELEMENT_SIZE / maskDownscale);
+    int closeSize = std::max(1, CLOSE_ELEMENT_SIZE / maskDownscale);
+    openElement =
+    cv::getStructuringElement(cv::MORPH_ELLIPSE, cv::Size(openSize, openSize));
+    closeElement = cv::getStructuringElement(cv::MORPH_ELLIPSE,
+                                             cv::Size(closeSize, closeSize));
+    reflectElement(openElement, openElementReflected, openAnchorReflected);
+    reflectElement(closeElement, closeElementReflected, closeAnchorReflected);
+}
+
+void HSVFilter::setMaskDownscale(int downscale) {
+    maskDownscale = std::max(1, downscale);
+    createStructuringElements();
+}
+
+void HSVFilter::setUseLookupTable(bool useTable) {
+    useLookupTable = useTable;
+}
+
+void HSVFilter::updateLookupTable() {
+    std::vector<int> thresholds = {
+    _iLowH, _iHighH, _iLowS, _iHighS, _iLowV, _iHighV};
+    if (thresholds == lookupTableThresholds) return;
+    lookupTableThresholds = thresholds;
+
+    // Threshold every colour the same way filterImage would, one blue value
+    // at a time, with green as the row and red as the column
+    cv::Mat colours(256, 256, CV_8UC3), hsvColours, inRangeColours;
+    for (int green = 0; green < 256; green++) {
+        cv::Vec3b* colour = colours.ptr<cv::Vec3b>(green);
+        for (int red = 0; red < 256; red++) {
+            colour[red] = cv::Vec3b(0, green, red);
+        }
+    }
+
+    lookupTable.assign((1 << 24) / 8, 0);
+    for (int blue = 0; blue < 256; blue++) {
+        for (int green = 0; green < 256; green++) {
+            cv::Vec3b* colour = colours.ptr<cv::Vec3b>(green);
+            for (int red = 0; red < 256; red++) { colour[red][0] = blue; }
+        }
+        cv::cvtColor(colours, hsvColours, CV_BGR2HSV, 0);
+        cv::inRange(hsvColours,
+                    cv::Scalar(_iLowH, _iLowS, _iLowV),
+                    cv::Scalar(_iHighH, _iHighS, _iHighV),
+                    inRangeColours);
+
+        // inRangeColours is continuous, so its index is (green << 8) | red
+        const uint8_t* colourInRange = inRangeColours.ptr<uint8_t>(0);
+        uint8_t* bits                = lookupTable.data() + (blue << 16) / 8;
+        for (int i = 0; i < 256 * 256; i++) {
+            if (colourInRange[i]) bits[i / 8] |= 1 << (i % 8);
+        }
+    }
 }
 
 // Functions
@@ -54,34 +135,61 @@ void HSVFilter::stopManualCalibration() {
 }
 
 void HSVFilter::filterImage(const cv::Mat& input, cv::Mat& output) {
-    cv::cvtColor(input, hsvOutput, CV_BGR2HSV, 0);
-    cv::inRange(hsvOutput,
-                cv::Scalar(_iLowH, _iLowS, _iLowV),
-                cv::Scalar(_iHighH, _iHighS, _iHighV),
-                rangeOutput);
-
-    // Determines how many times to erode then dilate
-    int noise_filter_count = 5;
-    for (int i = 0; i < noise_filter_count; i++) {
-        cv::Size size = cv::Size(2, 2);
-        // Morphological Opening (removes small objects from foreground)
-        cv::erode(rangeOutput,
-                  rangeOutput,
-                  getStructuringElement(cv::MORPH_ELLIPSE, size));
-        cv::dilate(rangeOutput,
-                   rangeOutput,
-                   getStructuringElement(cv::MORPH_ELLIPSE, size));
-
-        cv::Size size2 = cv::Size(10, 10);
-        // Morphological Closing (fill small holes in the foreground)
-        cv::dilate(rangeOutput,
-                   rangeOutput,
-                   getStructuringElement(cv::MORPH_ELLIPSE, size2));
-        cv::erode(rangeOutput,
-                  rangeOutput,
-                  getStructuringElement(cv::MORPH_ELLIPSE, size2));
+    if (maskDownscale == 1) {
+        threshold(input, output);
+        removeNoise(output);
+        return;
+    }
+
+    // Make the mask small, then scale it back up to the size of the input.
+    // An image smaller than the downscale still keeps a pixel on each side.
+    cv::Size smallSize(std::max(1, input.cols / maskDownscale),
+                       std::max(1, input.rows / maskDownscale));
+    cv::resize(input, smallInput, smallSize, 0, 0, cv::INTER_AREA);
+    threshold(smallInput, rangeOutput);
+    removeNoise(rangeOutput);
+    cv::resize(rangeOutput, output, input.size(), 0, 0, cv::INTER_NEAREST);
+}
+
+void HSVFilter::threshold(const cv::Mat& input, cv::Mat& output) {
+    // The table only covers 3 channel colours
+    if (!useLookupTable || input.type() != CV_8UC3) {
+        cv::cvtColor(input, hsvOutput, CV_BGR2HSV, 0);
+        cv::inRange(hsvOutput,
+                    cv::Scalar(_iLowH, _iLowS, _iLowV),
+                    cv::Scalar(_iHighH, _iHighS, _iHighV),
+                    output);
+        return;
+    }
+
+    updateLookupTable();
+    output.create(input.size(), CV_8UC1);
+    const uint8_t* table = lookupTable.data();
+    for (int row = 0; row < input.rows; row++) {
+        const uint8_t* pixel = input.ptr<uint8_t>(row);
+        uint8_t* mask        = output.ptr<uint8_t>(row);
+        for (int col = 0; col < input.cols; col++, pixel += 3) {
+            uint32_t colour = (pixel[0] << 16) | (pixel[1] << 8) | pixel[2];
+            mask[col] = (table[colour >> 3] >> (colour & 7)) & 1 ? 255 : 0;
+        }
     }
-    rangeOutput.copyTo(output);
+}
+
+void HSVFilter::removeNoise(cv::Mat& mask) {
+    // Dilating with the reflected element makes these a true opening and
+    // closing, and an opening followed by a closing is idempotent, so one
+    // pass of each is all it takes. This deliberately replaces the old
+    // passes, which weren't true openings and closings: they shifted the
+    // mask each time, and were repeated 5 times over. The masks differ from
+    // the old ones at the edges of the shapes.
+
+    // Morphological Opening (removes small objects from foreground)
+    cv::erode(mask, mask, openElement);
+    cv::dilate(mask, mask, openElementReflected, openAnchorReflected);
+
+    // Morphological Closing (fill small holes in the foreground)
+    cv::dilate(mask, mask, closeElement);
+    cv::erode(mask, mask, closeElementReflected, closeAnchorReflected);
 }
 
 void HSVFilter::printValues(void) {
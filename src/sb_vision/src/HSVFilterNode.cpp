@@ -19,6 +19,20 @@ HSVFilterNode::HSVFilterNode(int argc, char** argv, std::string node_name) {
     ros::NodeHandle nh;
     ros::NodeHandle private_nh("~");
 
+    setUpNode(nh, private_nh);
+}
+
+HSVFilterNode::HSVFilterNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh) {
+    displayWindowName  = "Snowbots - HSVFilterNode";
+    receivedFirstImage = false;
+
+    setUpNode(nh, private_nh);
+}
+
+void HSVFilterNode::setUpNode(ros::NodeHandle& nh,
+                              ros::NodeHandle& private_nh) {
+    this->private_nh = private_nh;
+
     // Set topics
     std::string image_topic  = "/robot/vision/raw_image";
     std::string output_topic = "/vision/hsv_filtered_image";
@@ -43,6 +57,8 @@ HSVFilterNode::HSVFilterNode(int argc, char** argv, std::string node_name) {
     SB_getParam(private_nh, "show_image_window", showWindow, true);
     SB_getParam(
     private_nh, "show_calibration_window", isCalibratingManually, false);
+    SB_getParam(private_nh, "mask_downscale", mask_downscale, 1);
+    SB_getParam(private_nh, "use_lookup_table", use_lookup_table, true);
 
     setUpFilter();
 }
@@ -51,7 +67,6 @@ void HSVFilterNode::rawImageCallBack(
 const sensor_msgs::Image::ConstPtr& image) {
     if (!receivedFirstImage) {
         ROS_INFO("First image received!");
-        ros::NodeHandle private_nh("~");
         SB_getParam(private_nh, "image_width", image_width, (int) image->width);
         SB_getParam(
         private_nh, "image_height", image_height, (int) image->height);
@@ -62,7 +77,7 @@ const sensor_msgs::Image::ConstPtr& image) {
 
     // Filter out non-green colors
     Mat filteredImage;
-    filter.filterImage(imageInput, filteredImage);
+    filter.filterImage(imageInput->image, filteredImage);
     filterOutput = filteredImage;
 
     // If enough time has passed update filter and show image
@@ -72,17 +87,17 @@ const sensor_msgs::Image::ConstPtr& image) {
         updateFilter();
     }
 
-    // Outputs the image
+    // Outputs the image, stamped with the time the camera took it
     sensor_msgs::ImagePtr output_message =
-    cv_bridge::CvImage(std_msgs::Header(), "mono8", filteredImage).toImageMsg();
+    cv_bridge::CvImage(image->header, "mono8", filteredImage).toImageMsg();
     // Publish recommended Twist message
     filter_pub.publish(output_message);
 }
 
-Mat HSVFilterNode::rosToMat(const sensor_msgs::Image::ConstPtr& image) {
-    CvImagePtr imagePtr;
-    imagePtr = toCvCopy(image, image->encoding);
-    return imagePtr->image;
+CvImageConstPtr
+HSVFilterNode::rosToMat(const sensor_msgs::Image::ConstPtr& image) {
+    // The image is only ever read, so there's no need to copy it
+    return toCvShare(image);
 }
 
 void HSVFilterNode::setUpFilter() {
@@ -119,6 +134,8 @@ void HSVFilterNode::setUpFilter() {
         filter = HSVFilter(0, 155, 0, 155, 150, 255);
     }
     filter_file.close();
+    filter.setMaskDownscale(mask_downscale);
+    filter.setUseLookupTable(use_lookup_table);
 
     ROS_INFO("Waiting for first image");
 }
@@ -162,7 +179,7 @@ void HSVFilterNode::showRawAndFilteredImageWindow() {
     // Image 1
     cv::Mat image1Roi(
     main_image, cv::Rect(0, 0, sub_window_size.width, sub_window_size.height));
-    resize(imageInput, image1Roi, sub_window_size);
+    resize(imageInput->image, image1Roi, sub_window_size);
 
     // Image 2
     Mat filterOutputBGR;
@@ -26,7 +26,7 @@ IPM::IPM(const cv::Size& _origSize,
     m_H     = getPerspectiveTransform(m_origPoints, m_dstPoints);
     m_H_inv = m_H.inv();
 
-    createMaps();
+    createMaps(m_dstSize, m_H_inv, m_map1, m_map2);
 }
 
 IPM::IPM() {}
@@ -81,8 +81,8 @@ void IPM::applyHomography(const Mat& _inputImg, Mat& _dstImg, int _borderMode) {
     // Generate IPM image from src
     remap(_inputImg,
           _dstImg,
-          m_mapX,
-          m_mapY,
+          m_map1,
+          m_map2,
           INTER_LINEAR,
           _borderMode); //, BORDER_CONSTANT, Scalar(0,0,0,0));
 }
@@ -90,11 +90,17 @@ void IPM::applyHomography(const Mat& _inputImg, Mat& _dstImg, int _borderMode) {
 void IPM::applyHomographyInv(const Mat& _inputImg,
                              Mat& _dstImg,
                              int _borderMode) {
-    // Generate IPM image from src
+    // Most users never go back to the original perspective, so only make the
+    // maps for it when they're needed
+    if (m_invMap1.empty()) {
+        createMaps(m_origSize, m_H, m_invMap1, m_invMap2);
+    }
+
+    // Generate src image from IPM
     remap(_inputImg,
           _dstImg,
-          m_mapX,
-          m_mapY,
+          m_invMap1,
+          m_invMap2,
           INTER_LINEAR,
           _borderMode); //, BORDER_CONSTANT, Scalar(0,0,0,0));
 }
@@ -152,32 +158,35 @@ Point3d IPM::applyHomography(const Point3d& _point, const cv::Mat& _H) {
 }
 
 // Private
-void IPM::createMaps() {
-    // Create remap images
-    m_mapX.create(m_dstSize, CV_32F);
-    m_mapY.create(m_dstSize, CV_32F);
-    for (int j = 0; j < m_dstSize.height; ++j) {
-        float* ptRowX = m_mapX.ptr<float>(j);
-        float* ptRowY = m_mapY.ptr<float>(j);
-        for (int i = 0; i < m_dstSize.width; ++i) {
-            Point2f pt = applyHomography(
-            Point2f(static_cast<float>(i), static_cast<float>(j)), m_H_inv);
-            ptRowX[i] = pt.x;
-            ptRowY[i] = pt.y;
+void IPM::createMaps(const cv::Size& size,
+                     const cv::Mat& H,
+                     cv::Mat& map1,
+                     cv::Mat& map2) {
+    Mat mapX(size, CV_32F), mapY(size, CV_32F);
+
+    // Moving one pixel along a row always adds the first column of H to the
+    // homogeneous point, so each row only needs its start computed
+    const double* h = H.ptr<double>(0);
+    for (int j = 0; j < size.height; ++j) {
+        float* ptRowX = mapX.ptr<float>(j);
+        float* ptRowY = mapY.ptr<float>(j);
+        double u      = h[1] * j + h[2];
+        double v      = h[4] * j + h[5];
+        double s      = h[7] * j + h[8];
+        for (int i = 0; i < size.width; ++i) {
+            if (s != 0) {
+                ptRowX[i] = static_cast<float>(u / s);
+                ptRowY[i] = static_cast<float>(v / s);
+            } else {
+                ptRowX[i] = -1;
+                ptRowY[i] = -1;
+            }
+            u += h[0];
+            v += h[3];
+            s += h[6];
         }
     }
 
-    m_invMapX.create(m_origSize, CV_32F);
-    m_invMapY.create(m_origSize, CV_32F);
-
-    for (int j = 0; j < m_origSize.height; ++j) {
-        float* ptRowX = m_invMapX.ptr<float>(j);
-        float* ptRowY = m_invMapY.ptr<float>(j);
-        for (int i = 0; i < m_origSize.width; ++i) {
-            Point2f pt = applyHomography(
-            Point2f(static_cast<float>(i), static_cast<float>(j)), m_H);
-            ptRowX[i] = pt.x;
-            ptRowY[i] = pt.y;
-        }
-    }
-}
\ No newline at end of file
+    // Fixed point maps save remap from converting the float ones every call
+    convertMaps(mapX, mapY, map1, map2, CV_16SC2);
+}
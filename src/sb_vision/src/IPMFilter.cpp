@@ -29,39 +29,59 @@ void IPMFilter::createFilter(float ipm_base_width,
                              float ipm_top_displacement,
                              float image_height,
                              float image_width) {
-    x1 = image_width / 2 - ipm_base_width / 2 * image_width;
-    y1 = (1 - ipm_base_displacement) * image_height;
-    x2 = image_width / 2 + ipm_base_width / 2 * image_width;
-    y2 = (1 - ipm_base_displacement) * image_height;
-    x3 = image_width / 2 + ipm_top_width / 2 * image_width;
-    y3 = image_height * ipm_top_displacement;
-    x4 = image_width / 2 - ipm_top_width / 2 * image_width;
-    y4 = image_height * ipm_top_displacement;
+    getIPMPoints(ipm_base_width,
+                 ipm_top_width,
+                 ipm_base_displacement,
+                 ipm_top_displacement,
+                 image_height,
+                 image_width,
+                 orig_points,
+                 dst_points);
+
+    // Create the IPM transformer
+    ipm = IPM(Size(image_width, image_height),
+              Size(image_width, image_height),
+              orig_points,
+              dst_points);
+}
+
+void IPMFilter::getIPMPoints(float ipm_base_width,
+                             float ipm_top_width,
+                             float ipm_base_displacement,
+                             float ipm_top_displacement,
+                             float image_height,
+                             float image_width,
+                             std::vector<cv::Point2f>& orig_points,
+                             std::vector<cv::Point2f>& dst_points) {
+    // Corners of the portion of the image to be filtered
+    int x1 = image_width / 2 - ipm_base_width / 2 * image_width;
+    int y1 = (1 - ipm_base_displacement) * image_height;
+    int x2 = image_width / 2 + ipm_base_width / 2 * image_width;
+    int y2 = (1 - ipm_base_displacement) * image_height;
+    int x3 = image_width / 2 + ipm_top_width / 2 * image_width;
+    int y3 = image_height * ipm_top_displacement;
+    int x4 = image_width / 2 - ipm_top_width / 2 * image_width;
+    int y4 = image_height * ipm_top_displacement;
 
     // Set up the IPM points
+    orig_points.clear();
     orig_points.push_back(Point2f(x1, y1));
     orig_points.push_back(Point2f(x2, y2));
     orig_points.push_back(Point2f(x3, y3));
     orig_points.push_back(Point2f(x4, y4));
 
+    dst_points.clear();
     dst_points.push_back(Point2f(0, image_height));
     dst_points.push_back(Point2f(image_width, image_height));
     dst_points.push_back(Point2f(image_width, 0));
     dst_points.push_back(Point2f(0, 0));
-
-    // Create the IPM transformer
-    ipm = IPM(Size(image_width, image_height),
-              Size(image_width, image_height),
-              orig_points,
-              dst_points);
 }
 
 void IPMFilter::filterImage(const cv::Mat& input, cv::Mat& output) {
     // If input image is empty then quit
     if (!input.empty()) {
-        Mat workingImage;
-        input.copyTo(workingImage);
-        // Applies the IPM to the image
-        ipm.applyHomography(workingImage, output);
+        // Applies the IPM to the image (remap only reads the input, so it
+        // doesn't need its own copy)
+        ipm.applyHomography(input, output);
     }
 }
@@ -13,15 +13,28 @@ using namespace cv_bridge;
 IPMFilterNode::IPMFilterNode(int argc, char** argv, std::string node_name) {
     receivedFirstImage = false;
 
-    // Set topics
-    std::string image_topic  = "/vision/hsv_filtered_image";
-    std::string output_topic = "/vision/ipm_filtered_image";
-
     // ROS
     ros::init(argc, argv, node_name);
     ros::NodeHandle nh;
     ros::NodeHandle private_nh("~");
 
+    setUpNode(nh, private_nh);
+}
+
+IPMFilterNode::IPMFilterNode(ros::NodeHandle& nh, ros::NodeHandle& private_nh) {
+    receivedFirstImage = false;
+
+    setUpNode(nh, private_nh);
+}
+
+void IPMFilterNode::setUpNode(ros::NodeHandle& nh,
+                              ros::NodeHandle& private_nh) {
+    this->private_nh = private_nh;
+
+    // Set topics
+    std::string image_topic  = "/vision/hsv_filtered_image";
+    std::string output_topic = "/vision/ipm_filtered_image";
+
     // Setup image transport
     image_transport::ImageTransport it(nh);
 
@@ -46,7 +59,6 @@ IPMFilterNode::IPMFilterNode(){};
 void IPMFilterNode::filteredImageCallBack(
 const sensor_msgs::ImageConstPtr& msg) {
     if (!receivedFirstImage) {
-        ros::NodeHandle private_nh("~");
         ROS_INFO("First image received! (IPM)");
         receivedFirstImage = true;
         // Obtains parameters of image and IPM points from the param server
@@ -61,21 +73,20 @@ const sensor_msgs::ImageConstPtr& msg) {
                                   image_width);
     }
 
+    // Shares the message's data, which msg keeps alive until we're done
     Mat imageInput = rosToMat(msg);
     Mat IPMFilteredImage;
 
     // Filter the image
     ipmFilter->filterImage(imageInput, IPMFilteredImage);
 
-    // Outputs the image
+    // Outputs the image, stamped with the time the camera took it
     sensor_msgs::ImagePtr output_message =
-    cv_bridge::CvImage(std_msgs::Header(), "mono8", IPMFilteredImage)
-    .toImageMsg();
+    cv_bridge::CvImage(msg->header, "mono8", IPMFilteredImage).toImageMsg();
     ipm_filter_pub.publish(output_message);
 }
 
 Mat IPMFilterNode::rosToMat(const sensor_msgs::Image::ConstPtr& image) {
-    CvImagePtr imagePtr;
-    imagePtr = toCvCopy(image, image->encoding);
-    return imagePtr->image;
+    // The image is only ever read, so there's no need to copy it
+    return toCvShare(image)->image;
 }
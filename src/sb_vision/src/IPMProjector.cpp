@@ -0,0 +1,108 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Projects the white pixels of a camera mask straight onto the
+ *              ground in front of the robot, through the same homography
+ *              IPMFilter warps images with, without warping the image
+ */
+
+#include <IPMFilter.h>
+#include <IPMProjector.h>
+
+// STD
+#include <algorithm>
+#include <cmath>
+
+IPMProjector::IPMProjector(float ipm_base_width,
+                           float ipm_top_width,
+                           float ipm_base_displacement,
+                           float ipm_top_displacement,
+                           float image_height,
+                           float image_width,
+                           double area_width,
+                           double area_length,
+                           double area_distance)
+  : area_width(area_width),
+    area_length(area_length),
+    area_distance(area_distance) {
+    std::vector<cv::Point2f> orig_points, dst_points;
+    IPMFilter::getIPMPoints(ipm_base_width,
+                            ipm_top_width,
+                            ipm_base_displacement,
+                            ipm_top_displacement,
+                            image_height,
+                            image_width,
+                            orig_points,
+                            dst_points);
+    cv::Mat ipm_H = cv::getPerspectiveTransform(orig_points, dst_points);
+
+    // The top of the IPM image is the far edge of the area, and its left
+    // side is the left edge of the area, so scaling and offsetting the rows
+    // of the IPM homography gives one straight to the ground
+    const double* ipm_h = ipm_H.ptr<double>(0);
+    double x_scale      = -area_length / image_height;
+    double x_offset     = area_distance + area_length;
+    double y_scale      = -area_width / image_width;
+    double y_offset     = area_width / 2;
+    for (int col = 0; col < 3; col++) {
+        H[col]     = x_scale * ipm_h[3 + col] + x_offset * ipm_h[6 + col];
+        H[3 + col] = y_scale * ipm_h[col] + y_offset * ipm_h[6 + col];
+        H[6 + col] = ipm_h[6 + col];
+    }
+}
+
+bool IPMProjector::projectPixel(double col,
+                                double row,
+                                cv::Point2d& point) const {
+    double s = H[6] * col + H[7] * row + H[8];
+    if (s == 0) return false;
+    point.x = (H[0] * col + H[1] * row + H[2]) / s;
+    point.y = (H[3] * col + H[4] * row + H[5]) / s;
+
+    // The homography maps exactly the IPM portion of the image to the area
+    return point.x >= area_distance && point.x <= area_distance + area_length &&
+           std::abs(point.y) <= area_width / 2;
+}
+
+void IPMProjector::projectMask(const cv::Mat& mask,
+                               std::vector<cv::Point2d>& points) const {
+    points.clear();
+    cv::Point2d point;
+    for (int row = 0; row < mask.rows; row++) {
+        const uint8_t* pixels = mask.ptr<uint8_t>(row);
+        for (int col = 0; col < mask.cols; col++) {
+            if (pixels[col] != 0 && projectPixel(col, row, point)) {
+                points.push_back(point);
+            }
+        }
+    }
+}
+
+void IPMProjector::makeOccupancyGrid(const std::vector<cv::Point2d>& points,
+                                     double resolution,
+                                     nav_msgs::OccupancyGrid& grid) const {
+    // Round down sizes that are a whole number of cells plus rounding error
+    int width  = std::max(1, (int) std::ceil(area_length / resolution - 1e-6));
+    int height = std::max(1, (int) std::ceil(area_width / resolution - 1e-6));
+
+    grid.info.resolution           = resolution;
+    grid.info.width                = width;
+    grid.info.height               = height;
+    grid.info.origin.position.x    = area_distance;
+    grid.info.origin.position.y    = -area_width / 2;
+    grid.info.origin.position.z    = 0;
+    grid.info.origin.orientation.x = 0;
+    grid.info.origin.orientation.y = 0;
+    grid.info.origin.orientation.z = 0;
+    grid.info.origin.orientation.w = 1;
+
+    // The whole area is seen, so every cell without a point is free
+    grid.data.assign(width * height, 0);
+    for (const cv::Point2d& point : points) {
+        int col = (int) ((point.x - area_distance) / resolution);
+        int row = (int) ((point.y + area_width / 2) / resolution);
+        col     = std::min(std::max(col, 0), width - 1);
+        row     = std::min(std::max(row, 0), height - 1);
+        grid.data[row * width + col] = 100;
+    }
+}
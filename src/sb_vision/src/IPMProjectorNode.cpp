@@ -0,0 +1,95 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Projects the white pixels of filtered images straight onto
+ *              the ground, and publishes them as an occupancy grid
+ */
+
+#include <IPMProjectorNode.h>
+
+IPMProjectorNode::IPMProjectorNode(int argc,
+                                   char** argv,
+                                   std::string node_name) {
+    // ROS
+    ros::init(argc, argv, node_name);
+    ros::NodeHandle nh;
+    ros::NodeHandle private_nh("~");
+
+    setUpNode(nh, private_nh);
+}
+
+IPMProjectorNode::IPMProjectorNode(ros::NodeHandle& nh,
+                                   ros::NodeHandle& private_nh) {
+    setUpNode(nh, private_nh);
+}
+
+void IPMProjectorNode::setUpNode(ros::NodeHandle& nh,
+                                 ros::NodeHandle& private_nh) {
+    this->private_nh = private_nh;
+
+    // Set topics
+    std::string image_topic  = "/vision/hsv_filtered_image";
+    std::string output_topic = "/vision/lane_occupancy_grid";
+
+    // Setup image transport
+    image_transport::ImageTransport it(nh);
+
+    // Setup subscriber
+    uint32_t queue_size = 1;
+    image_sub           = it.subscribe(
+    image_topic, queue_size, &IPMProjectorNode::filteredImageCallBack, this);
+
+    // Setup publisher
+    grid_pub = nh.advertise<nav_msgs::OccupancyGrid>(output_topic, queue_size);
+
+    SB_getParam(private_nh, "ipm_base_width", ipm_base_width, (float) 1);
+    SB_getParam(private_nh, "ipm_top_width", ipm_top_width, (float) 0.5);
+    SB_getParam(
+    private_nh, "ipm_base_displacement", ipm_base_displacement, (float) 0);
+    SB_getParam(
+    private_nh, "ipm_top_displacement", ipm_top_displacement, (float) 0.25);
+
+    SB_getParam(private_nh, "area_width", area_width, 4.0);
+    SB_getParam(private_nh, "area_length", area_length, 4.0);
+    SB_getParam(private_nh, "area_distance", area_distance, 1.0);
+    SB_getParam(private_nh, "resolution", resolution, 0.05);
+    SB_getParam(private_nh, "frame_id", frame_id, std::string("base_link"));
+}
+
+void IPMProjectorNode::filteredImageCallBack(
+const sensor_msgs::ImageConstPtr& msg) {
+    if (!projector) {
+        ROS_INFO("First image received! (IPM Projector)");
+        // Obtains parameters of image from the param server
+        int image_width, image_height;
+        SB_getParam(private_nh, "image_width", image_width, (int) msg->width);
+        SB_getParam(
+        private_nh, "image_height", image_height, (int) msg->height);
+        projector.reset(new IPMProjector(ipm_base_width,
+                                         ipm_top_width,
+                                         ipm_base_displacement,
+                                         ipm_top_displacement,
+                                         image_height,
+                                         image_width,
+                                         area_width,
+                                         area_length,
+                                         area_distance));
+    }
+
+    // The image is only ever read, so there's no need to copy it
+    cv::Mat mask = cv_bridge::toCvShare(msg)->image;
+
+    // Only the white pixels are projected, the image itself is never warped
+    projector->projectMask(mask, points);
+
+    // Stamped with the time the camera took the image, if it was given one
+    ros::Time stamp =
+    msg->header.stamp.isZero() ? ros::Time::now() : msg->header.stamp;
+
+    nav_msgs::OccupancyGridPtr grid(new nav_msgs::OccupancyGrid());
+    grid->header.stamp       = stamp;
+    grid->header.frame_id    = frame_id;
+    grid->info.map_load_time = stamp;
+    projector->makeOccupancyGrid(points, resolution, *grid);
+    grid_pub.publish(grid);
+}
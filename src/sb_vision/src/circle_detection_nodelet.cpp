@@ -0,0 +1,22 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which publishes whether circles are seen in
+ *              filtered images, see CircleDetection
+ */
+
+#include <circle_detection_nodelet.h>
+#include <pluginlib/class_list_macros.h>
+
+using namespace sb_vision;
+
+CircleDetectionNodelet::CircleDetectionNodelet() {}
+
+void CircleDetectionNodelet::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    node.reset(new CircleDetection(getNodeHandle(), getPrivateNodeHandle()));
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(sb_vision::CircleDetectionNodelet, nodelet::Nodelet)
@@ -0,0 +1,148 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Times HSVFilter::filterImage (in each of its modes) on the
+ *              given images against the filter it replaced (5 rounds of
+ *              erode/dilate with structuring elements built every pass), and
+ *              prints the latency of each frame as a histogram
+ *
+ * Usage: rosrun sb_vision hsv_filter_benchmark <image>... [-r repeats]
+ */
+
+#include <HSVFilter.h>
+#include <LatencyHistogram.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace snowbots;
+
+/**
+ * The filter HSVFilter::filterImage used to be, with its default thresholds
+ */
+static void legacyFilterImage(const cv::Mat& input, cv::Mat& output) {
+    int sensitivity = 30;
+    cv::Mat hsvOutput, rangeOutput;
+    cv::cvtColor(input, hsvOutput, CV_BGR2HSV, 0);
+    cv::inRange(hsvOutput,
+                cv::Scalar(60 - sensitivity, 100, 100),
+                cv::Scalar(60 + sensitivity, 255, 255),
+                rangeOutput);
+
+    for (int i = 0; i < 5; i++) {
+        cv::Size size = cv::Size(2, 2);
+        cv::erode(rangeOutput,
+                  rangeOutput,
+                  getStructuringElement(cv::MORPH_ELLIPSE, size));
+        cv::dilate(rangeOutput,
+                   rangeOutput,
+                   getStructuringElement(cv::MORPH_ELLIPSE, size));
+
+        cv::Size size2 = cv::Size(10, 10);
+        cv::dilate(rangeOutput,
+                   rangeOutput,
+                   getStructuringElement(cv::MORPH_ELLIPSE, size2));
+        cv::erode(rangeOutput,
+                  rangeOutput,
+                  getStructuringElement(cv::MORPH_ELLIPSE, size2));
+    }
+    rangeOutput.copyTo(output);
+}
+
+/**
+ * Times a filter on every image, after running it on each once untimed
+ */
+template <typename Filter>
+static LatencyHistogram timeFilter(const std::string& name,
+                                   const std::vector<cv::Mat>& images,
+                                   unsigned int repeats,
+                                   Filter filter) {
+    LatencyHistogram histogram(name);
+    cv::Mat output;
+
+    for (const cv::Mat& image : images) { filter(image, output); }
+
+    for (unsigned int repeat = 0; repeat < repeats; repeat++) {
+        for (const cv::Mat& image : images) {
+            auto start = std::chrono::steady_clock::now();
+            filter(image, output);
+            auto end = std::chrono::steady_clock::now();
+
+            histogram.add(
+            std::chrono::duration<double, std::micro>(end - start).count());
+        }
+    }
+
+    return histogram;
+}
+
+int main(int argc, char** argv) {
+    unsigned int repeats = 20;
+    std::vector<cv::Mat> images;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            repeats = atoi(argv[++i]);
+            continue;
+        }
+        cv::Mat image = cv::imread(argv[i]);
+        if (image.empty()) {
+            fprintf(stderr, "Could not load image %s\n", argv[i]);
+            return 1;
+        }
+        images.push_back(image);
+    }
+    if (images.empty()) {
+        fprintf(stderr, "Usage: %s <image>... [-r repeats]\n", argv[0]);
+        return 1;
+    }
+
+    HSVFilter filter;
+    HSVFilter half_size_filter;
+    half_size_filter.setMaskDownscale(2);
+    HSVFilter lookup_table_filter;
+    lookup_table_filter.setUseLookupTable(true);
+
+    // How much the new masks differ from the old ones
+    for (const cv::Mat& image : images) {
+        cv::Mat legacy_mask, mask;
+        legacyFilterImage(image, legacy_mask);
+        filter.filterImage(image, mask);
+        printf(
+        "%dx%d image: %d pixels differ from the legacy mask, which "
+        "has %d white pixels\n",
+        image.cols,
+        image.rows,
+        cv::countNonZero(legacy_mask != mask),
+        cv::countNonZero(legacy_mask));
+    }
+    printf("\n");
+
+    timeFilter("legacy filter", images, repeats, legacyFilterImage).print();
+    printf("\n");
+    timeFilter("HSVFilter::filterImage",
+               images,
+               repeats,
+               [&](const cv::Mat& input, cv::Mat& output) {
+                   filter.filterImage(input, output);
+               })
+    .print();
+    printf("\n");
+    timeFilter("HSVFilter::filterImage (mask_downscale 2)",
+               images,
+               repeats,
+               [&](const cv::Mat& input, cv::Mat& output) {
+                   half_size_filter.filterImage(input, output);
+               })
+    .print();
+    printf("\n");
+    timeFilter("HSVFilter::filterImage (use_lookup_table)",
+               images,
+               repeats,
+               [&](const cv::Mat& input, cv::Mat& output) {
+                   lookup_table_filter.filterImage(input, output);
+               })
+    .print();
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which filters camera images in the HSV colourspace
+ *              to a binary image, see HSVFilterNode
+ */
+
+#include <hsv_filter_nodelet.h>
+#include <pluginlib/class_list_macros.h>
+
+using namespace sb_vision;
+
+HSVFilterNodelet::HSVFilterNodelet() {}
+
+void HSVFilterNodelet::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    node.reset(new HSVFilterNode(getNodeHandle(), getPrivateNodeHandle()));
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(sb_vision::HSVFilterNodelet, nodelet::Nodelet)
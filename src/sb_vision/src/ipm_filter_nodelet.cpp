@@ -0,0 +1,22 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which applies inverse perspective mapping to
+ *              filtered images, see IPMFilterNode
+ */
+
+#include <ipm_filter_nodelet.h>
+#include <pluginlib/class_list_macros.h>
+
+using namespace sb_vision;
+
+IPMFilterNodelet::IPMFilterNodelet() {}
+
+void IPMFilterNodelet::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    node.reset(new IPMFilterNode(getNodeHandle(), getPrivateNodeHandle()));
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(sb_vision::IPMFilterNodelet, nodelet::Nodelet)
@@ -0,0 +1,20 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Projects the white pixels of filtered images onto the ground
+ *              and publishes them as an occupancy grid
+ */
+
+#include <IPMProjectorNode.h>
+#include <ros/ros.h>
+
+int main(int argc, char** argv) {
+    // Setup your ROS node
+    std::string node_name = "ipm_projector";
+    // Create an instance of your class
+    IPMProjectorNode ipm_projector(argc, argv, node_name);
+    // Start up ROS, this will continue to run until the node is killed
+    ros::spin();
+    // Once the node stops, return 0
+    return 0;
+}
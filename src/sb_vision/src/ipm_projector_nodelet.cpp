@@ -0,0 +1,22 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: A ros nodelet which projects filtered images onto the ground
+ *              as an occupancy grid, see IPMProjectorNode
+ */
+
+#include <ipm_projector_nodelet.h>
+#include <pluginlib/class_list_macros.h>
+
+using namespace sb_vision;
+
+IPMProjectorNodelet::IPMProjectorNodelet() {}
+
+void IPMProjectorNodelet::onInit() {
+    NODELET_DEBUG("Initializing Nodelet...");
+    node.reset(new IPMProjectorNode(getNodeHandle(), getPrivateNodeHandle()));
+    NODELET_DEBUG("Nodelet Initialized");
+}
+
+// Allows this node to be exported and registered as a nodelet
+PLUGINLIB_EXPORT_CLASS(sb_vision::IPMProjectorNodelet, nodelet::Nodelet)
@@ -17,6 +17,49 @@ TEST(realImage, GreenLight) {
     EXPECT_EQ(1, num_circles);
 }
 
+TEST(realImage, GreenLightDownscaledMask) {
+    std::string image_path = "images/GreenLight.jpg";
+
+    cv::Mat bgr_image = imread(image_path);
+    Mat filtered_image;
+
+    HSVFilter test_filter = HSVFilter();
+    test_filter.setMaskDownscale(2);
+    test_filter.filterImage(bgr_image, filtered_image);
+    EXPECT_EQ(bgr_image.size(), filtered_image.size());
+
+    CircleDetection* circle_detection = new CircleDetection();
+    int num_circles = circle_detection->countCircles(filtered_image, false);
+
+    EXPECT_EQ(1, num_circles);
+}
+
+TEST(filteredImage, downscaleLargerThanImage) {
+    // Narrower and shorter than the downscale
+    cv::Mat bgr_image(3, 1, CV_8UC3, cv::Scalar(0, 255, 0));
+    Mat filtered_image;
+
+    HSVFilter test_filter = HSVFilter();
+    test_filter.setMaskDownscale(4);
+    test_filter.filterImage(bgr_image, filtered_image);
+
+    EXPECT_EQ(bgr_image.size(), filtered_image.size());
+}
+
+TEST(realImage, lookupTableMatchesHSVConversion) {
+    std::string image_path = "images/GreenLight.jpg";
+
+    cv::Mat bgr_image = imread(image_path);
+    Mat filtered_image, table_filtered_image;
+
+    HSVFilter test_filter = HSVFilter();
+    test_filter.filterImage(bgr_image, filtered_image);
+    test_filter.setUseLookupTable(true);
+    test_filter.filterImage(bgr_image, table_filtered_image);
+
+    EXPECT_EQ(0, cv::countNonZero(filtered_image != table_filtered_image));
+}
+
 TEST(realImage, noCircle) {
     std::string image_path = "images/RedLight.jpg";
 
@@ -0,0 +1,84 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for IPMProjector
+ */
+
+#include <IPMProjector.h>
+#include <gtest/gtest.h>
+
+class IPMProjectorTest : public testing::Test {
+  protected:
+    IPMProjectorTest()
+      : // The default IPM params on a 100x100 image, covering a 4m wide, 3m
+        // long area starting 1m in front of the robot
+        projector(1, 0.5, 0, 0.25, 100, 100, 4, 3, 1) {}
+
+    IPMProjector projector;
+};
+
+TEST_F(IPMProjectorTest, cornersOfIPMPortionAreCornersOfArea) {
+    cv::Point2d point;
+
+    projector.projectPixel(0, 100, point);
+    EXPECT_NEAR(1, point.x, 1e-9);
+    EXPECT_NEAR(2, point.y, 1e-9);
+
+    projector.projectPixel(100, 100, point);
+    EXPECT_NEAR(1, point.x, 1e-9);
+    EXPECT_NEAR(-2, point.y, 1e-9);
+
+    projector.projectPixel(75, 25, point);
+    EXPECT_NEAR(4, point.x, 1e-9);
+    EXPECT_NEAR(-2, point.y, 1e-9);
+
+    projector.projectPixel(25, 25, point);
+    EXPECT_NEAR(4, point.x, 1e-9);
+    EXPECT_NEAR(2, point.y, 1e-9);
+}
+
+TEST_F(IPMProjectorTest, pixelsOutsideIPMPortionAreNotProjected) {
+    cv::Point2d point;
+    EXPECT_TRUE(projector.projectPixel(50, 50, point));
+    EXPECT_FALSE(projector.projectPixel(50, 10, point));
+    EXPECT_FALSE(projector.projectPixel(5, 30, point));
+}
+
+TEST_F(IPMProjectorTest, onlyWhitePixelsInAreaAreProjected) {
+    cv::Mat mask = cv::Mat::zeros(100, 100, CV_8UC1);
+    mask.at<uint8_t>(50, 50) = 255;
+    mask.at<uint8_t>(10, 50) = 255;
+
+    std::vector<cv::Point2d> points;
+    projector.projectMask(mask, points);
+
+    ASSERT_EQ(1, points.size());
+    cv::Point2d expected;
+    projector.projectPixel(50, 50, expected);
+    EXPECT_DOUBLE_EQ(expected.x, points[0].x);
+    EXPECT_DOUBLE_EQ(expected.y, points[0].y);
+}
+
+TEST_F(IPMProjectorTest, occupancyGridMarksCellsWithPoints) {
+    std::vector<cv::Point2d> points = {{1.05, 1.95}, {3.99, -0.01}};
+
+    nav_msgs::OccupancyGrid grid;
+    projector.makeOccupancyGrid(points, 0.1, grid);
+
+    ASSERT_EQ(30, grid.info.width);
+    ASSERT_EQ(40, grid.info.height);
+    EXPECT_DOUBLE_EQ(1, grid.info.origin.position.x);
+    EXPECT_DOUBLE_EQ(-2, grid.info.origin.position.y);
+    ASSERT_EQ(30 * 40, grid.data.size());
+
+    EXPECT_EQ(100, grid.data[39 * 30 + 0]);
+    EXPECT_EQ(100, grid.data[19 * 30 + 29]);
+    int occupied = 0;
+    for (int8_t cell : grid.data) { occupied += cell == 100; }
+    EXPECT_EQ(2, occupied);
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,58 @@
+/*
+ * Created By: Snowbots Software
+ * Created On: October 19, 2026
+ * Description: Tests for IPM
+ */
+
+#include <IPM.h>
+#include <gtest/gtest.h>
+
+class IPMTest : public testing::Test {
+  protected:
+    virtual void SetUp() {
+        // A gradient, so that every shift of it is different
+        image.create(48, 64, CV_8UC1);
+        for (int row = 0; row < image.rows; row++) {
+            for (int col = 0; col < image.cols; col++) {
+                image.at<uint8_t>(row, col) = row * 4 + col;
+            }
+        }
+
+        // A homography that moves everything 10 pixels to the right
+        std::vector<cv::Point2f> orig_points = {
+        {10, 10}, {30, 10}, {30, 30}, {10, 30}};
+        std::vector<cv::Point2f> dst_points;
+        for (const cv::Point2f& point : orig_points) {
+            dst_points.push_back(point + cv::Point2f(10, 0));
+        }
+        ipm = IPM(image.size(), image.size(), orig_points, dst_points);
+    }
+
+    cv::Mat image;
+    IPM ipm;
+};
+
+TEST_F(IPMTest, applyHomographyMovesImage) {
+    cv::Mat output;
+    ipm.applyHomography(image, output);
+
+    ASSERT_EQ(image.size(), output.size());
+    EXPECT_EQ(0, cv::countNonZero(output.colRange(0, 10)));
+    EXPECT_EQ(
+    0, cv::countNonZero(output.colRange(10, 64) != image.colRange(0, 54)));
+}
+
+TEST_F(IPMTest, applyHomographyInvUndoesApplyHomography) {
+    cv::Mat output, inv_output;
+    ipm.applyHomography(image, output);
+    ipm.applyHomographyInv(output, inv_output);
+
+    ASSERT_EQ(image.size(), inv_output.size());
+    EXPECT_EQ(
+    0, cv::countNonZero(inv_output.colRange(0, 54) != image.colRange(0, 54)));
+}
+
+int main(int argc, char** argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}